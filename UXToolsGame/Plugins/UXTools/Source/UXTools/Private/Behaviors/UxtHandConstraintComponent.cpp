@@ -303,20 +303,18 @@ bool UUxtHandConstraintComponent::UpdateHandBounds(const FVector& PalmLocation,
 	FTransform PalmFromWorld = WorldFromPalm.Inverse();
 	HandBounds = FBox(EForceInit::ForceInitToZero);
 
-	for (int i = 0; i < EHandKeypointCount; ++i)
+	const FUxtHandSnapshot& HandSnapshot = IUxtHandTracker::Get().GetHandSnapshot(TrackedHand);
+	if (!HandSnapshot.bHasJoints)
 	{
-		EHandKeypoint Joint = (EHandKeypoint)i;
+		return false;
+	}
 
-		FQuat JointRotation;
-		FVector JointLocation;
-		float JointRadius;
-		if (!IUxtHandTracker::Get().GetJointState(TrackedHand, Joint, JointRotation, JointLocation, JointRadius))
-		{
-			continue;
-		}
+	for (int i = 0; i < EHandKeypointCount; ++i)
+	{
+		const float JointRadius = HandSnapshot.JointRadii[i];
 
 		// Joint position in palm coordinates
-		FVector LocalLoc = PalmFromWorld.TransformPosition(JointLocation);
+		FVector LocalLoc = PalmFromWorld.TransformPosition(HandSnapshot.JointPositions[i]);
 		// Union with box around the joint, using radius for padding
 		HandBounds += FBox(LocalLoc - FVector::OneVector * JointRadius, LocalLoc + FVector::OneVector * JointRadius);
 	}
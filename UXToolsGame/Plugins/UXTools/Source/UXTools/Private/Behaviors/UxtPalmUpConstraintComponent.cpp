@@ -43,35 +43,29 @@ namespace
 			checkNoEntry();
 		}
 
-		FVector ReferenceJointLocation1;
-		FVector ReferenceJointLocation2;
-		FQuat Orientation;
-		float Radius;
-		if (!IUxtHandTracker::Get().GetJointState(Hand, ReferenceJoint1, Orientation, ReferenceJointLocation1, Radius) ||
-			!IUxtHandTracker::Get().GetJointState(Hand, ReferenceJoint2, Orientation, ReferenceJointLocation2, Radius))
+		const FUxtHandSnapshot& HandSnapshot = IUxtHandTracker::Get().GetHandSnapshot(Hand);
+		if (!HandSnapshot.bHasJoints)
 		{
 			return false;
 		}
 
-		OutActivationPoint = FMath::Lerp(ReferenceJointLocation1, ReferenceJointLocation2, 0.5f);
+		OutActivationPoint = FMath::Lerp(
+			HandSnapshot.JointPositions[(int32)ReferenceJoint1], HandSnapshot.JointPositions[(int32)ReferenceJoint2], 0.5f);
 		return true;
 	}
 
 	bool GetHandPlaneAndActivationPoint(EControllerHand Hand, EUxtHandConstraintZone Zone, FPlane& OutHandPlane, FVector& OutActivationPoint)
 	{
-		FVector WristPosition;
-		FVector IndexPosition;
-		FVector LittlePosition;
-		FQuat Orientation;
-		float Radius;
-
-		if (!IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::Wrist, Orientation, WristPosition, Radius) ||
-			!IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::IndexMetacarpal, Orientation, IndexPosition, Radius) ||
-			!IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::LittleMetacarpal, Orientation, LittlePosition, Radius))
+		const FUxtHandSnapshot& HandSnapshot = IUxtHandTracker::Get().GetHandSnapshot(Hand);
+		if (!HandSnapshot.bHasJoints)
 		{
 			return false;
 		}
 
+		const FVector WristPosition = HandSnapshot.JointPositions[(int32)EHandKeypoint::Wrist];
+		const FVector IndexPosition = HandSnapshot.JointPositions[(int32)EHandKeypoint::IndexMetacarpal];
+		const FVector LittlePosition = HandSnapshot.JointPositions[(int32)EHandKeypoint::LittleMetacarpal];
+
 		FVector ActivationPoint;
 		if (!GetActivationPoint(Hand, Zone, ActivationPoint))
 		{
@@ -138,15 +132,15 @@ bool UUxtPalmUpConstraintComponent::IsPalmUp(const FTransform& HeadPose, const F
 bool UUxtPalmUpConstraintComponent::IsHandFlat(EControllerHand NewHand, const FVector& PalmLocation, const FVector& PalmUpVector) const
 {
 	// Test Palm-Index-Ring triangle against palm for measuring flatness
-	FQuat IndexRotation, RingRotation;
-	FVector IndexLocation, RingLocation;
-	float IndexRadius, RingRadius;
-	if (!IUxtHandTracker::Get().GetJointState(NewHand, EHandKeypoint::IndexTip, IndexRotation, IndexLocation, IndexRadius) ||
-		!IUxtHandTracker::Get().GetJointState(NewHand, EHandKeypoint::RingTip, RingRotation, RingLocation, RingRadius))
+	const FUxtHandSnapshot& HandSnapshot = IUxtHandTracker::Get().GetHandSnapshot(NewHand);
+	if (!HandSnapshot.bHasJoints)
 	{
 		return false;
 	}
 
+	const FVector IndexLocation = HandSnapshot.JointPositions[(int32)EHandKeypoint::IndexTip];
+	const FVector RingLocation = HandSnapshot.JointPositions[(int32)EHandKeypoint::RingTip];
+
 	FVector FingerNormal = FVector::CrossProduct(RingLocation - PalmLocation, IndexLocation - PalmLocation).GetSafeNormal();
 	if (NewHand != EControllerHand::Left)
 	{
@@ -63,6 +63,9 @@ void UUxtTapToPlaceComponent::SetTargetComponent(USceneComponent* Target)
 	{
 		DefaultSurfaceNormalOffset = GetDefaultSurfaceNormalOffset(Target);
 	}
+
+	// Far focusable primitives depend on the target
+	UUxtInputSubsystem::InvalidateFarTargets(GetOwner());
 }
 
 void UUxtTapToPlaceComponent::StartPlacement()
@@ -106,6 +109,18 @@ void UUxtTapToPlaceComponent::BeginPlay()
 	}
 }
 
+void UUxtTapToPlaceComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtInputSubsystem::RegisterInterfaceComponent(this);
+}
+
+void UUxtTapToPlaceComponent::OnUnregister()
+{
+	UUxtInputSubsystem::UnregisterInterfaceComponent(this);
+	Super::OnUnregister();
+}
+
 void UUxtTapToPlaceComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -140,7 +155,18 @@ void UUxtTapToPlaceComponent::TickComponent(float DeltaTime, ELevelTick TickType
 			FHitResult Result;
 			FVector Start = OriginPose.GetLocation();
 			FVector End = Start + OriginPose.GetUnitAxis(EAxis::X) * MaxRaycastDistance;
-			GetWorld()->LineTraceSingleByChannel(Result, Start, End, TraceChannel, QueryParams);
+			const UUxtFarPointerComponent* FarPointer = PlacementType == EUxtTapToPlaceMode::Hand ? FocusLockedPointerWeak.Get() : nullptr;
+			if (FarPointer && FarPointer->bAsyncTrace)
+			{
+				// Queue the ray of the extrapolated pointer pose, its result is used in the next frame
+				const FTransform QueuePose = FarPointer->GetAsyncTracePose();
+				const FVector QueueEnd = QueuePose.GetLocation() + QueuePose.GetUnitAxis(EAxis::X) * MaxRaycastDistance;
+				PlacementTrace.TraceAsync(GetWorld(), Result, Start, End, QueuePose.GetLocation(), QueueEnd, TraceChannel, QueryParams);
+			}
+			else
+			{
+				PlacementTrace.Trace(GetWorld(), Result, Start, End, TraceChannel, QueryParams);
+			}
 
 			FVector HitPosition = Start + OriginPose.GetUnitAxis(EAxis::X) * DefaultPlacementDistance;
 			FVector Facing = OriginPose.GetLocation() - HitPosition;
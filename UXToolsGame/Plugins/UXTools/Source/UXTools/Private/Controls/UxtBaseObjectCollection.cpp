@@ -15,8 +15,62 @@ namespace
 
 		FUxtSortScrollingObjectCollectionDelegate ComparisonFunctor;
 	};
+
+	/** Sort the actors by keys requested once per actor, comparing the keys natively. Equal keys keep their relative order. */
+	template <typename KeyType, typename DelegateType>
+	void SortActorsByKey(TArray<AActor*>& Actors, const DelegateType& GetSortKey)
+	{
+		TArray<TPair<KeyType, AActor*>> KeyedActors;
+		KeyedActors.Reserve(Actors.Num());
+		for (AActor* Actor : Actors)
+		{
+			KeyedActors.Emplace(GetSortKey.Execute(Actor), Actor);
+		}
+
+		KeyedActors.StableSort([](const TPair<KeyType, AActor*>& A, const TPair<KeyType, AActor*>& B) { return A.Key < B.Key; });
+
+		for (int32 Index = 0; Index < Actors.Num(); ++Index)
+		{
+			Actors[Index] = KeyedActors[Index].Value;
+		}
+	}
 } // namespace
 
+/**
+ *
+ */
+void UUxtBaseObjectCollection::SetSortCallback(const FUxtSortScrollingObjectCollectionDelegate& Callback)
+{
+	ResetSortCallbacks();
+	SortCollection = Callback;
+}
+
+/**
+ *
+ */
+void UUxtBaseObjectCollection::SetFloatSortKeyCallback(const FUxtObjectCollectionFloatSortKeyDelegate& Callback)
+{
+	ResetSortCallbacks();
+	FloatSortKey = Callback;
+}
+
+/**
+ *
+ */
+void UUxtBaseObjectCollection::SetStringSortKeyCallback(const FUxtObjectCollectionStringSortKeyDelegate& Callback)
+{
+	ResetSortCallbacks();
+	StringSortKey = Callback;
+}
+
+/**
+ *
+ */
+bool UUxtBaseObjectCollection::IsSorted() const
+{
+	return SortCollection.IsBound() || FloatSortKey.IsBound() || StringSortKey.IsBound();
+}
+
 /**
  *
  */
@@ -30,28 +84,71 @@ const TArray<AActor*>& UUxtBaseObjectCollection::CollectAttachedActors()
 		const bool bResetArray = false;
 		Owner->GetAttachedActors(AttachedActors, bResetArray);
 
-		// Give the user an opportunity to sort the array of attached actors
+		// Give the user an opportunity to sort the array of attached actors.
+		// Actors sorted by key keep their order until new actors are collected, so the keys don't need to be requested again.
 		if (SortCollection.IsBound())
 		{
 			AttachedActors.Sort(ComparisonPredicate(SortCollection));
+			++SortRevision;
 		}
-
-		for (AActor* Actor : AttachedActors)
+		else if ((FloatSortKey.IsBound() || StringSortKey.IsBound()) && AttachedActors.Num() != NumActorsSortedByKey)
 		{
-			TSet<UActorComponent*> Components = Actor->GetComponents();
-			for (UActorComponent* Comp : Components)
+			if (FloatSortKey.IsBound())
+			{
+				SortActorsByKey<float>(AttachedActors, FloatSortKey);
+			}
+			else
 			{
-				if (Comp->Implements<UUxtCollectionObject>())
-				{
-					CollectionObjectInterfaceComponents.Add(Comp);
-				}
+				SortActorsByKey<FString>(AttachedActors, StringSortKey);
 			}
+			NumActorsSortedByKey = AttachedActors.Num();
+			++SortRevision;
+		}
+
+		for (AActor* Actor : AttachedActors)
+		{
+			AddCollectionObjectInterfaceComponents(Actor);
 		}
 	}
 
 	return AttachedActors;
 }
 
+/**
+ *
+ */
+void UUxtBaseObjectCollection::AppendAttachedActor(AActor* Actor)
+{
+	AttachedActors.Add(Actor);
+	AddCollectionObjectInterfaceComponents(Actor);
+}
+
+/**
+ *
+ */
+void UUxtBaseObjectCollection::ResetSortCallbacks()
+{
+	SortCollection.Unbind();
+	FloatSortKey.Unbind();
+	StringSortKey.Unbind();
+	NumActorsSortedByKey = INDEX_NONE;
+	++SortRevision;
+}
+
+/**
+ *
+ */
+void UUxtBaseObjectCollection::AddCollectionObjectInterfaceComponents(const AActor* Actor)
+{
+	for (UActorComponent* Comp : Actor->GetComponents())
+	{
+		if (Comp->Implements<UUxtCollectionObject>())
+		{
+			CollectionObjectInterfaceComponents.Add(Comp);
+		}
+	}
+}
+
 /**
  *
  */
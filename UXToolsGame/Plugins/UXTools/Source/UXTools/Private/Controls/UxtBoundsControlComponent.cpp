@@ -4,8 +4,12 @@
 #include "Controls/UxtBoundsControlComponent.h"
 
 #include "Components/BoxComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Components/MeshComponent.h"
 #include "Components/PrimitiveComponent.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Controls/UxtBoundsControlSubsystem.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
@@ -75,12 +79,84 @@ namespace
 	const TArray<DistanceToScalePair> AffordanceDistToScale =
 		{{200.0f, 2.0f}, {400.0f, 4.0f}, {600.0f, 6.0f}, {800.0f, 8.0f}, {1000.0f, 10.0f}};
 
+	/** Record the state of a component in the bounds hierarchy. */
+	FUxtBoundsSourceEntry MakeBoundsSourceEntry(const USceneComponent* Component, bool bIsRoot)
+	{
+		FUxtBoundsSourceEntry Entry;
+		Entry.Component = Component;
+		Entry.RelativeTransform = bIsRoot ? FTransform::Identity : Component->GetRelativeTransform();
+		Entry.bIsRegistered = Component->IsRegistered();
+
+		if (const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component))
+		{
+			Entry.BoundsRadius = Primitive->Bounds.SphereRadius;
+
+			if (const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Primitive))
+			{
+				Entry.Mesh = StaticMeshComponent->GetStaticMesh();
+			}
+			else if (const USkinnedMeshComponent* SkinnedMeshComponent = Cast<USkinnedMeshComponent>(Primitive))
+			{
+				Entry.Mesh = SkinnedMeshComponent->SkeletalMesh;
+			}
+		}
+
+		return Entry;
+	}
+
+	bool IsSameBoundsSource(const FUxtBoundsSourceEntry& A, const FUxtBoundsSourceEntry& B)
+	{
+		return A.Component == B.Component && A.Mesh == B.Mesh && A.BoundsRadius == B.BoundsRadius && A.bIsRegistered == B.bIsRegistered &&
+			   A.RelativeTransform.Equals(B.RelativeTransform, 0.0f);
+	}
+
+	/**
+	 * Walk the hierarchy below the component and update the recorded entries in place.
+	 * Returns true if any entry differs from the previous state.
+	 */
+	bool UpdateBoundsSourceEntries(
+		const USceneComponent* Component, bool bIsRoot, TArray<FUxtBoundsSourceEntry>& Entries, int32& NumEntries)
+	{
+		// Components with absolute transforms move relative to the bounds root without changing their relative transform.
+		bool bChanged =
+			!bIsRoot && (Component->IsUsingAbsoluteLocation() || Component->IsUsingAbsoluteRotation() || Component->IsUsingAbsoluteScale());
+
+		const FUxtBoundsSourceEntry Entry = MakeBoundsSourceEntry(Component, bIsRoot);
+		if (NumEntries < Entries.Num())
+		{
+			bChanged |= !IsSameBoundsSource(Entries[NumEntries], Entry);
+			Entries[NumEntries] = Entry;
+		}
+		else
+		{
+			Entries.Add(Entry);
+			bChanged = true;
+		}
+		++NumEntries;
+
+		for (const USceneComponent* Child : Component->GetAttachChildren())
+		{
+			if (Child)
+			{
+				bChanged |= UpdateBoundsSourceEntries(Child, false, Entries, NumEntries);
+			}
+		}
+
+		return bChanged;
+	}
+
 	static FName LeftPositionParam("LeftPointerPosition");
 	static FName RightPositionParam("RightPointerPosition");
 	static FName OpacityParam("Opacity");
 	static FName IsFocusedParam("IsFocused");
 	static FName IsActiveParam("IsActive");
 
+	/** Per-instance custom data layout of instanced affordances. */
+	constexpr int32 OpacityCustomDataIndex = 0;
+	constexpr int32 IsFocusedCustomDataIndex = 1;
+	constexpr int32 IsActiveCustomDataIndex = 2;
+	constexpr int32 NumAffordanceCustomData = 3;
+
 	/** Utility function to get the focused primitive */
 	UPrimitiveComponent* GetFocusedPrimitive(const UUxtNearPointerComponent* NearPointer)
 	{
@@ -161,6 +237,30 @@ namespace
 		}
 		return RotationPlane;
 	}
+
+	/** Update the relative transform of an instance, returns true if it has changed. */
+	bool UpdateInstanceTransformIfChanged(UInstancedStaticMeshComponent* InstancedMesh, int32 InstanceIndex, const FTransform& Transform)
+	{
+		FTransform CurrentTransform;
+		if (InstancedMesh->GetInstanceTransform(InstanceIndex, CurrentTransform) && CurrentTransform.Equals(Transform, 0.0f))
+		{
+			return false;
+		}
+		InstancedMesh->UpdateInstanceTransform(InstanceIndex, Transform, false, false, true);
+		return true;
+	}
+
+	/** Update a custom data value of an instance, returns true if it has changed. */
+	bool SetCustomDataValueIfChanged(UInstancedStaticMeshComponent* InstancedMesh, int32 InstanceIndex, int32 CustomDataIndex, float Value)
+	{
+		const int32 Offset = InstanceIndex * InstancedMesh->NumCustomDataFloats + CustomDataIndex;
+		if (InstancedMesh->PerInstanceSMCustomData.IsValidIndex(Offset) && InstancedMesh->PerInstanceSMCustomData[Offset] == Value)
+		{
+			return false;
+		}
+		InstancedMesh->SetCustomDataValue(InstanceIndex, CustomDataIndex, Value, false);
+		return true;
+	}
 } // namespace
 
 UUxtBoundsControlComponent::UUxtBoundsControlComponent()
@@ -234,17 +334,7 @@ const FBox& UUxtBoundsControlComponent::GetBounds() const
 
 void UUxtBoundsControlComponent::ComputeBoundsFromComponents()
 {
-	const USceneComponent* Override = Cast<USceneComponent>(BoundsOverride.GetComponent(GetOwner()));
-	const USceneComponent* BoundsTargetComponent = nullptr;
-	if (Override)
-	{
-		BoundsTargetComponent = Override;
-	}
-	else if (GetOwner())
-	{
-		BoundsTargetComponent = GetOwner()->GetRootComponent();
-	}
-	if (BoundsTargetComponent)
+	if (const USceneComponent* BoundsTargetComponent = GetBoundsTargetComponent())
 	{
 		const FTransform BoundsTargetToWorld = BoundsTargetComponent->GetComponentTransform();
 		Bounds =
@@ -273,11 +363,13 @@ void UUxtBoundsControlComponent::CreateAffordances()
 	if (!IsValid(Config))
 	{
 		UE_LOG(LogUxtBoundsControl, Error, TEXT("Config asset is invalid"));
+		bAffordanceCreationFailed = true;
 		return;
 	}
 	if (!GetOwner())
 	{
 		UE_LOG(LogUxtBoundsControl, Error, TEXT("Bounds control component needs owning actor to create affordances"));
+		bAffordanceCreationFailed = true;
 		return;
 	}
 
@@ -310,6 +402,15 @@ void UUxtBoundsControlComponent::CreateAffordances()
 	BoundsControlGrabbable->OnUpdateGrab.AddDynamic(this, &UUxtBoundsControlComponent::OnAffordanceUpdateGrab);
 	BoundsControlGrabbable->OnEndGrab.AddDynamic(this, &UUxtBoundsControlComponent::OnAffordanceEndGrab);
 
+	// Affordance mesh materials read scalar parameters, so instancing without a custom data material would lose all highlighting
+	const bool bUseInstancedRendering = bUseInstancedAffordanceRendering && InstancedAffordanceMaterial;
+	if (bUseInstancedAffordanceRendering && !InstancedAffordanceMaterial)
+	{
+		UE_LOG(
+			LogUxtBoundsControl, Warning,
+			TEXT("Instanced affordance rendering requires an instanced affordance material, rendering affordances individually"));
+	}
+
 	for (const FUxtAffordanceConfig& AffordanceConfig : Config->Affordances)
 	{
 		// Create the mesh component for visuals and collision
@@ -323,13 +424,26 @@ void UUxtBoundsControlComponent::CreateAffordances()
 			MeshComponent->SetStaticMesh(AffordanceMesh);
 		}
 
-		// Each affordance gets its own dynamic material instance for highlighting
-		UMaterialInstanceDynamic* DynamicMaterial = MeshComponent->CreateDynamicMaterialInstance(0);
+		FUxtAffordanceInstance AffordanceInstance = {AffordanceConfig, nullptr};
+		if (bUseInstancedRendering)
+		{
+			// Affordance is drawn by the instanced mesh of its kind, the primitive is only used for collision
+			MeshComponent->SetVisibility(false);
+
+			UInstancedStaticMeshComponent* InstancedMesh = GetOrCreateAffordanceInstancedMesh(AffordanceConfig.GetAffordanceKind());
+			AffordanceInstance.RenderInstanceIndex = InstancedMesh->AddInstance(FTransform::Identity);
+		}
+		else
+		{
+			// Each affordance gets its own dynamic material instance for highlighting
+			AffordanceInstance.DynamicMaterial = MeshComponent->CreateDynamicMaterialInstance(0);
+		}
 
 		// Register the affordance
-		FUxtAffordanceInstance AffordanceInstance = {AffordanceConfig, DynamicMaterial};
 		PrimitiveAffordanceMap.Add(MeshComponent, AffordanceInstance);
 	}
+
+	bAffordanceTransformsValid = false;
 }
 
 void UUxtBoundsControlComponent::DestroyAffordances()
@@ -356,6 +470,8 @@ void UUxtBoundsControlComponent::DestroyAffordances()
 
 	// Destroy affordances
 	PrimitiveAffordanceMap.Empty();
+	AffordanceInstancedMeshes.Empty();
+	bAffordanceTransformsValid = false;
 	GetWorld()->DestroyActor(BoundsControlActor);
 }
 
@@ -376,6 +492,11 @@ void UUxtBoundsControlComponent::UpdateAffordanceTransforms()
 		BoundsControlActor->SetActorLocationAndRotation(Location, Rotation);
 	}
 
+	bAffordanceTransformsValid = true;
+	AffordanceBounds = Bounds;
+	AffordanceTargetTransform = BoundsTargetComponent->GetComponentTransform();
+	AffordanceOwnerTransform = GetOwner()->GetTransform();
+
 	const FVector ActorCenterLoc = GetOwner()->GetTransform().TransformPosition(Bounds.GetCenter());
 	for (auto& Item : PrimitiveAffordanceMap)
 	{
@@ -426,6 +547,8 @@ void UUxtBoundsControlComponent::UpdateAffordanceAnimation(float DeltaTime)
 	}
 
 	// Update animation for each affordance
+	bAnyAffordanceVisible = false;
+	TArray<UInstancedStaticMeshComponent*, TInlineAllocator<4>> ChangedInstancedMeshes;
 	for (auto& Item : PrimitiveAffordanceMap)
 	{
 		UPrimitiveComponent* AffordancePrimitive = Item.Key;
@@ -473,16 +596,51 @@ void UUxtBoundsControlComponent::UpdateAffordanceAnimation(float DeltaTime)
 			FMath::Clamp(AffordanceInstance.FocusedTransition + (bAffordanceIsFocused ? TransitionDelta : -TransitionDelta), 0.0f, 1.0f);
 		AffordanceInstance.ActiveTransition =
 			FMath::Clamp(AffordanceInstance.ActiveTransition + (bAffordanceIsActive ? TransitionDelta : -TransitionDelta), 0.0f, 1.0f);
+		bAnyAffordanceVisible |= bIsVisible;
 
-		AffordancePrimitive->SetHiddenInGame(!bIsVisible);
-		if (AffordanceInstance.DynamicMaterial)
-		{
-			AffordanceInstance.DynamicMaterial->SetScalarParameterValue(OpacityParam, Opacity);
-			AffordanceInstance.DynamicMaterial->SetScalarParameterValue(IsFocusedParam, AffordanceInstance.FocusedTransition);
-			AffordanceInstance.DynamicMaterial->SetScalarParameterValue(IsActiveParam, AffordanceInstance.ActiveTransition);
-		}
 		AffordancePrimitive->SetRelativeScale3D(
 			AffordanceInstance.ReferenceRelativeScale * (1.0f + 0.2f * AffordanceInstance.FocusedTransition));
+
+		if (AffordanceInstance.RenderInstanceIndex != INDEX_NONE)
+		{
+			// Render state of the instanced meshes is marked dirty once after all affordances are updated, and only if anything changed
+			UInstancedStaticMeshComponent* InstancedMesh = AffordanceInstancedMeshes.FindRef(AffordanceInstance.Config.GetAffordanceKind());
+			if (InstancedMesh)
+			{
+				FTransform InstanceTransform = AffordancePrimitive->GetRelativeTransform();
+				if (!bIsVisible)
+				{
+					InstanceTransform.SetScale3D(FVector::ZeroVector);
+				}
+
+				const int32 Index = AffordanceInstance.RenderInstanceIndex;
+				const float Focused = AffordanceInstance.FocusedTransition;
+				const float Active = AffordanceInstance.ActiveTransition;
+				bool bChanged = UpdateInstanceTransformIfChanged(InstancedMesh, Index, InstanceTransform);
+				bChanged |= SetCustomDataValueIfChanged(InstancedMesh, Index, OpacityCustomDataIndex, Opacity);
+				bChanged |= SetCustomDataValueIfChanged(InstancedMesh, Index, IsFocusedCustomDataIndex, Focused);
+				bChanged |= SetCustomDataValueIfChanged(InstancedMesh, Index, IsActiveCustomDataIndex, Active);
+				if (bChanged)
+				{
+					ChangedInstancedMeshes.AddUnique(InstancedMesh);
+				}
+			}
+		}
+		else
+		{
+			AffordancePrimitive->SetHiddenInGame(!bIsVisible);
+			if (AffordanceInstance.DynamicMaterial)
+			{
+				AffordanceInstance.DynamicMaterial->SetScalarParameterValue(OpacityParam, Opacity);
+				AffordanceInstance.DynamicMaterial->SetScalarParameterValue(IsFocusedParam, AffordanceInstance.FocusedTransition);
+				AffordanceInstance.DynamicMaterial->SetScalarParameterValue(IsActiveParam, AffordanceInstance.ActiveTransition);
+			}
+		}
+	}
+
+	for (UInstancedStaticMeshComponent* InstancedMesh : ChangedInstancedMeshes)
+	{
+		InstancedMesh->MarkRenderStateDirty();
 	}
 }
 
@@ -495,6 +653,9 @@ void UUxtBoundsControlComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	bAffordanceCreationFailed = false;
+	bIsSleeping = false;
+
 	if (bInitBoundsFromActor)
 	{
 		ComputeBoundsFromComponents();
@@ -504,15 +665,28 @@ void UUxtBoundsControlComponent::BeginPlay()
 		Bounds = FBox(EForceInit::ForceInitToZero);
 	}
 
-	CreateAffordances();
+	if (!bDeferAffordanceCreation)
+	{
+		CreateAffordances();
+	}
 	UpdateAffordanceTransforms();
 	ResetConstraintsReferenceTransform();
 
 	CreateCollisionBox();
+
+	if (UUxtBoundsControlSubsystem* Subsystem = GetWorld()->GetSubsystem<UUxtBoundsControlSubsystem>())
+	{
+		Subsystem->RegisterBoundsControl(this);
+	}
 }
 
 void UUxtBoundsControlComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UUxtBoundsControlSubsystem* Subsystem = GetWorld()->GetSubsystem<UUxtBoundsControlSubsystem>())
+	{
+		Subsystem->UnregisterBoundsControl(this);
+	}
+
 	DestroyAffordances();
 	// Needs to be destroyed explicitly because it's attached to the owning actor
 	CollisionBox->UnregisterComponent();
@@ -538,12 +712,34 @@ void UUxtBoundsControlComponent::TickComponent(float DeltaTime, ELevelTick TickT
 			TransformTarget(AffordanceInstance.Config, GrabPointer);
 		}
 	}
-	ComputeBoundsFromComponents();
-	UpdateAffordanceTransforms();
+
+	const USceneComponent* BoundsTargetComponent = GetBoundsTargetComponent();
+	bBoundsSourceChanged = !bIncrementalBoundsUpdate || !BoundsTargetComponent || UpdateBoundsSourceState(BoundsTargetComponent);
+	if (bBoundsSourceChanged)
+	{
+		ComputeBoundsFromComponents();
+	}
+
+	if (!bIncrementalBoundsUpdate || NeedsAffordanceTransformUpdate())
+	{
+		UpdateAffordanceTransforms();
+	}
 
 	UpdateAffordanceAnimation(DeltaTime);
 }
 
+bool UUxtBoundsControlComponent::NeedsAffordanceTransformUpdate() const
+{
+	const USceneComponent* BoundsTargetComponent = GetBoundsTargetComponent();
+	if (!bAffordanceTransformsValid || !BoundsTargetComponent)
+	{
+		return true;
+	}
+
+	return !(AffordanceBounds == Bounds) || !AffordanceTargetTransform.Equals(BoundsTargetComponent->GetComponentTransform(), 0.0f) ||
+		   !AffordanceOwnerTransform.Equals(GetOwner()->GetTransform(), 0.0f);
+}
+
 void UUxtBoundsControlComponent::TransformTarget(const FUxtAffordanceConfig& AffordanceConfig, const FUxtGrabPointerData& GrabPointer) const
 {
 	const FTransform GrabTransform = GrabPointer.GrabPointTransform;
@@ -762,6 +958,97 @@ void UUxtBoundsControlComponent::CreateCollisionBox()
 	}
 }
 
+bool UUxtBoundsControlComponent::CanSleep() const
+{
+	if (GrabbedAffordances.Num() > 0 || bAnyAffordanceVisible || bBoundsSourceChanged || NeedsAffordanceTransformUpdate())
+	{
+		return false;
+	}
+
+	for (const auto& Item : PrimitiveAffordanceMap)
+	{
+		const FUxtAffordanceInstance& AffordanceInstance = Item.Value;
+		if (AffordanceInstance.FocusCount > 0 || AffordanceInstance.FocusedTransition > 0.0f || AffordanceInstance.ActiveTransition > 0.0f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UUxtBoundsControlComponent::SetAwake(bool bAwake)
+{
+	if (bAwake)
+	{
+		if (bIsSleeping)
+		{
+			bIsSleeping = false;
+			SetComponentTickEnabled(true);
+		}
+	}
+	else if (!bIsSleeping && IsComponentTickEnabled())
+	{
+		bIsSleeping = true;
+		SetComponentTickEnabled(false);
+	}
+}
+
+void UUxtBoundsControlComponent::CreateDeferredAffordances()
+{
+	if (bDeferAffordanceCreation && !BoundsControlActor && !bAffordanceCreationFailed)
+	{
+		CreateAffordances();
+		UpdateAffordanceTransforms();
+	}
+}
+
+UInstancedStaticMeshComponent* UUxtBoundsControlComponent::GetOrCreateAffordanceInstancedMesh(EUxtAffordanceKind Kind)
+{
+	if (UInstancedStaticMeshComponent* InstancedMesh = AffordanceInstancedMeshes.FindRef(Kind))
+	{
+		return InstancedMesh;
+	}
+
+	const FString KindName = StaticEnum<EUxtAffordanceKind>()->GetNameStringByValue(static_cast<int64>(Kind));
+	const FName InstancedMeshName = FName(TEXT("AffordanceInstances_") + KindName);
+	UInstancedStaticMeshComponent* InstancedMesh = NewObject<UInstancedStaticMeshComponent>(BoundsControlActor, InstancedMeshName);
+	InstancedMesh->AttachToComponent(BoundsControlActor->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	InstancedMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	InstancedMesh->NumCustomDataFloats = NumAffordanceCustomData;
+	InstancedMesh->SetStaticMesh(GetAffordanceKindMesh(Kind));
+	InstancedMesh->SetMaterial(0, InstancedAffordanceMaterial);
+	InstancedMesh->RegisterComponent();
+	BoundsControlActor->AddInstanceComponent(InstancedMesh);
+
+	AffordanceInstancedMeshes.Add(Kind, InstancedMesh);
+	return InstancedMesh;
+}
+
+const USceneComponent* UUxtBoundsControlComponent::GetBoundsTargetComponent() const
+{
+	if (const USceneComponent* Override = Cast<USceneComponent>(BoundsOverride.GetComponent(GetOwner())))
+	{
+		return Override;
+	}
+	return GetOwner() ? GetOwner()->GetRootComponent() : nullptr;
+}
+
+bool UUxtBoundsControlComponent::UpdateBoundsSourceState(const USceneComponent* BoundsTargetComponent)
+{
+	int32 NumEntries = 0;
+	bool bChanged = UpdateBoundsSourceEntries(BoundsTargetComponent, true, BoundsSourceState, NumEntries);
+
+	// Components removed from the hierarchy
+	if (NumEntries < BoundsSourceState.Num())
+	{
+		BoundsSourceState.SetNum(NumEntries, false);
+		bChanged = true;
+	}
+
+	return bChanged;
+}
+
 void UUxtBoundsControlComponent::ResetConstraintsReferenceTransform()
 {
 	if (GetOwner())
@@ -0,0 +1,181 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Controls/UxtBoundsControlSubsystem.h"
+
+#include "Controls/UxtBoundsControlComponent.h"
+#include "Engine/World.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "UObject/ConstructorHelpers.h"
+
+namespace
+{
+	static FName LeftPositionParam("LeftPointerPosition");
+	static FName RightPositionParam("RightPointerPosition");
+
+	/** Bounding sphere of a box given in the local space of the transform. */
+	FSphere GetTransformedBoxSphere(const FBox& Box, const FTransform& Transform)
+	{
+		return FSphere(Transform.TransformPosition(Box.GetCenter()), Box.GetExtent().Size() * Transform.GetMaximumAxisScale());
+	}
+} // namespace
+
+UUxtBoundsControlSubsystem::UUxtBoundsControlSubsystem()
+{
+	static ConstructorHelpers::FObjectFinder<UMaterialParameterCollection> Finder(TEXT("/UXTools/Materials/MPC_UXSettings"));
+	ParameterCollection = Finder.Object;
+}
+
+void UUxtBoundsControlSubsystem::Deinitialize()
+{
+	BoundsControls.Empty();
+	NumAwakeBoundsControls = 0;
+}
+
+void UUxtBoundsControlSubsystem::Tick(float DeltaTime)
+{
+	FVector PointerPositions[2];
+	int32 NumPointers = 0;
+	if (ParameterCollection)
+	{
+		UMaterialParameterCollectionInstance* ParameterCollectionInstance = GetWorld()->GetParameterCollectionInstance(ParameterCollection);
+		FLinearColor Position;
+		if (ParameterCollectionInstance->GetVectorParameterValue(LeftPositionParam, Position))
+		{
+			PointerPositions[NumPointers++] = FVector(Position);
+		}
+		if (ParameterCollectionInstance->GetVectorParameterValue(RightPositionParam, Position))
+		{
+			PointerPositions[NumPointers++] = FVector(Position);
+		}
+	}
+
+	GatherBoundingSpheres();
+	TestPointerProximity(PointerPositions, NumPointers);
+
+	NumAwakeBoundsControls = 0;
+	for (int32 Index = 0; Index < BoundsControls.Num(); ++Index)
+	{
+		UUxtBoundsControlComponent* BoundsControl = BoundsControls[Index];
+		if (!BoundsControl->IsActive())
+		{
+			continue;
+		}
+
+		const bool bIsNearPointer = IsNearPointer[Index] != 0;
+		if (bIsNearPointer)
+		{
+			BoundsControl->CreateDeferredAffordances();
+		}
+
+		const bool bAwake = !BoundsControl->bSleepWhenIdle || bIsNearPointer || !BoundsControl->CanSleep();
+		BoundsControl->SetAwake(bAwake);
+		NumAwakeBoundsControls += bAwake ? 1 : 0;
+	}
+}
+
+ETickableTickType UUxtBoundsControlSubsystem::GetTickableTickType() const
+{
+	return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UUxtBoundsControlSubsystem::IsTickable() const
+{
+	return BoundsControls.Num() > 0;
+}
+
+TStatId UUxtBoundsControlSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UUxtBoundsControlSubsystem, STATGROUP_Tickables);
+}
+
+UWorld* UUxtBoundsControlSubsystem::GetTickableGameObjectWorld() const
+{
+	return GetWorld();
+}
+
+void UUxtBoundsControlSubsystem::RegisterBoundsControl(UUxtBoundsControlComponent* BoundsControl)
+{
+	BoundsControls.AddUnique(BoundsControl);
+}
+
+void UUxtBoundsControlSubsystem::UnregisterBoundsControl(UUxtBoundsControlComponent* BoundsControl)
+{
+	BoundsControls.RemoveSwap(BoundsControl);
+}
+
+int32 UUxtBoundsControlSubsystem::GetNumBoundsControls() const
+{
+	return BoundsControls.Num();
+}
+
+int32 UUxtBoundsControlSubsystem::GetNumAwakeBoundsControls() const
+{
+	return NumAwakeBoundsControls;
+}
+
+void UUxtBoundsControlSubsystem::GatherBoundingSpheres()
+{
+	// Entries are cleared by garbage collection when a bounds control is destroyed without unregistering
+	BoundsControls.RemoveAllSwap([](const UUxtBoundsControlComponent* BoundsControl) { return !IsValid(BoundsControl); }, false);
+
+	const int32 NumBoundsControls = BoundsControls.Num();
+	CentersX.SetNumUninitialized(NumBoundsControls, false);
+	CentersY.SetNumUninitialized(NumBoundsControls, false);
+	CentersZ.SetNumUninitialized(NumBoundsControls, false);
+	WakeRadiiSquared.SetNumUninitialized(NumBoundsControls, false);
+
+	for (int32 Index = 0; Index < NumBoundsControls; ++Index)
+	{
+		const UUxtBoundsControlComponent* BoundsControl = BoundsControls[Index];
+		const USceneComponent* BoundsTargetComponent = BoundsControl->GetBoundsTargetComponent();
+		const FTransform TargetTransform = BoundsTargetComponent ? BoundsTargetComponent->GetComponentTransform() : FTransform::Identity;
+
+		// Computed bounds of the whole target hierarchy, following the target if it moved while the control was asleep
+		FSphere Sphere = GetTransformedBoxSphere(BoundsControl->Bounds, TargetTransform);
+
+		// Affordances stay where they were last placed until the control wakes up
+		if (BoundsControl->bAffordanceTransformsValid)
+		{
+			Sphere += GetTransformedBoxSphere(BoundsControl->AffordanceBounds, BoundsControl->AffordanceTargetTransform);
+		}
+
+		const float WakeRadius = Sphere.W + BoundsControl->AffordanceVisibilityDistance;
+
+		CentersX[Index] = Sphere.Center.X;
+		CentersY[Index] = Sphere.Center.Y;
+		CentersZ[Index] = Sphere.Center.Z;
+		WakeRadiiSquared[Index] = WakeRadius * WakeRadius;
+	}
+}
+
+void UUxtBoundsControlSubsystem::TestPointerProximity(const FVector* PointerPositions, int32 NumPointers)
+{
+	const int32 NumBoundsControls = BoundsControls.Num();
+	IsNearPointer.SetNumUninitialized(NumBoundsControls, false);
+	FMemory::Memzero(IsNearPointer.GetData(), NumBoundsControls);
+	if (NumPointers == 0)
+	{
+		return;
+	}
+
+	const float* RESTRICT X = CentersX.GetData();
+	const float* RESTRICT Y = CentersY.GetData();
+	const float* RESTRICT Z = CentersZ.GetData();
+	const float* RESTRICT RadiiSquared = WakeRadiiSquared.GetData();
+	uint8* RESTRICT IsNear = IsNearPointer.GetData();
+
+	// Branch-free loops over packed arrays, so the compiler can vectorize them
+	for (int32 PointerIndex = 0; PointerIndex < NumPointers; ++PointerIndex)
+	{
+		const FVector& Pointer = PointerPositions[PointerIndex];
+		for (int32 Index = 0; Index < NumBoundsControls; ++Index)
+		{
+			const float DX = X[Index] - Pointer.X;
+			const float DY = Y[Index] - Pointer.Y;
+			const float DZ = Z[Index] - Pointer.Z;
+			IsNear[Index] |= (DX * DX + DY * DY + DZ * DZ) < RadiiSquared[Index];
+		}
+	}
+}
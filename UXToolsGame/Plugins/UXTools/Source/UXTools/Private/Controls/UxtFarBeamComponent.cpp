@@ -126,13 +126,15 @@ void UUxtFarBeamComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	if (UUxtFarPointerComponent* FarPointer = FarPointerWeak.Get())
 	{
-		const FVector Start = FarPointer->GetRayStart();
-		const FVector End = FarPointer->GetHitPoint() + FarPointer->GetHitNormal() * HoverDistance;
+		// Follow the predicted pointer pose so the beam lines up with the hand when the frame is displayed
+		const FQuat PointerOrientation = FarPointer->GetPredictedPointerOrientation();
+		const FVector Start = FarPointer->GetPredictedRayStart();
+		const FVector End = FarPointer->GetPredictedHitPoint() + FarPointer->GetHitNormal() * HoverDistance;
 		float Len = (Start - End).Size();
 
-		FVector Target = Start + (FarPointer->GetPointerOrientation().GetForwardVector() * Len);
+		FVector Target = Start + (PointerOrientation.GetForwardVector() * Len);
 		// Use hand forward vector to influence the beam start tangent
-		FVector SourceTangent = FarPointer->GetPointerOrientation().RotateVector(FVector(50, 0, 0));
+		FVector SourceTangent = PointerOrientation.RotateVector(FVector(50, 0, 0));
 		// Make end tangent point directly at the target
 		FVector EndTangent = End - Target;
 		SetStartPosition(Start, false);
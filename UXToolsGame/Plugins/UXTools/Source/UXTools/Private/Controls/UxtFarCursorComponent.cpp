@@ -87,9 +87,9 @@ void UUxtFarCursorComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 
 	if (UUxtFarPointerComponent* FarPointer = FarPointerWeak.Get())
 	{
-		// Place hovering the hit location
+		// Place hovering the hit location, following the predicted pointer pose so the cursor stays at the end of the beam
 		const FVector& HitNormal = FarPointer->GetHitNormal();
-		FVector Location = FarPointer->GetHitPoint() + HitNormal * HoverDistance;
+		FVector Location = FarPointer->GetPredictedHitPoint() + HitNormal * HoverDistance;
 		SetWorldLocation(Location);
 
 		// Align with hit normal
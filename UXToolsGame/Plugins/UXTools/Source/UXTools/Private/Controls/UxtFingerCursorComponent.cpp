@@ -32,27 +32,17 @@ namespace
 	 */
 	FTransform GetCursorTransform(EControllerHand Hand, FVector PointOnTarget, FVector Normal, float AlignWithSurfaceDistance)
 	{
-		bool foundValues = true;
-
-		FQuat IndexTipOrientation;
-		FVector IndexTipPosition;
-		float IndexTipRadius;
-
-		foundValues &=
-			IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::IndexTip, IndexTipOrientation, IndexTipPosition, IndexTipRadius);
-
-		FQuat IndexKnuckleOrientation;
-		FVector IndexKnucklePosition;
-		float IndexKnuckleRadius;
-
-		foundValues &= IUxtHandTracker::Get().GetJointState(
-			Hand, EHandKeypoint::IndexProximal, IndexKnuckleOrientation, IndexKnucklePosition, IndexKnuckleRadius);
-
-		if (!foundValues)
+		const FUxtHandSnapshot& HandSnapshot = IUxtHandTracker::Get().GetHandSnapshot(Hand);
+		if (!HandSnapshot.bHasJoints)
 		{
 			return FTransform::Identity;
 		}
 
+		const FQuat IndexTipOrientation = HandSnapshot.JointOrientations[(int32)EHandKeypoint::IndexTip];
+		const FVector IndexTipPosition = HandSnapshot.JointPositions[(int32)EHandKeypoint::IndexTip];
+		const float IndexTipRadius = HandSnapshot.JointRadii[(int32)EHandKeypoint::IndexTip];
+		const FVector IndexKnucklePosition = HandSnapshot.JointPositions[(int32)EHandKeypoint::IndexProximal];
+
 		FVector FingerDir = (IndexTipPosition - IndexKnucklePosition);
 		FingerDir.Normalize();
 
@@ -154,8 +144,16 @@ void UUxtFingerCursorComponent::TickComponent(float DeltaTime, ELevelTick TickTy
 				}
 			}
 
-			SetWorldTransform(
-				GetCursorTransform(HandPointer->Hand, PointOnTarget, SurfaceNormal, Target ? AlignWithSurfaceDistance : -1.0f));
+			FTransform CursorTransform =
+				GetCursorTransform(HandPointer->Hand, PointOnTarget, SurfaceNormal, Target ? AlignWithSurfaceDistance : -1.0f);
+
+			if (bFilterCursorTransform)
+			{
+				CursorTransform.SetLocation(LocationFilter.Filter(CursorTransform.GetLocation(), DeltaTime, LocationFilterSettings));
+				CursorTransform.SetRotation(RotationFilter.Filter(CursorTransform.GetRotation(), DeltaTime, RotationFilterSettings));
+			}
+
+			SetWorldTransform(CursorTransform);
 
 			float Alpha = 1.0f;
 
@@ -181,6 +179,8 @@ void UUxtFingerCursorComponent::TickComponent(float DeltaTime, ELevelTick TickTy
 			SetHiddenInGame(true);
 
 			CursorFadeScaler = InitalCursorFadeScaler;
+			LocationFilter.Reset();
+			RotationFilter.Reset();
 		}
 	}
 }
@@ -7,6 +7,7 @@
 
 #include "Components/BoxComponent.h"
 #include "Input/UxtFarPointerComponent.h"
+#include "Input/UxtInputSubsystem.h"
 #include "Input/UxtNearPointerComponent.h"
 
 namespace
@@ -147,6 +148,18 @@ void UUxtPinchSliderComponent::BeginPlay()
 	UpdateVisuals();
 }
 
+void UUxtPinchSliderComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtInputSubsystem::RegisterInterfaceComponent(this);
+}
+
+void UUxtPinchSliderComponent::OnUnregister()
+{
+	UUxtInputSubsystem::UnregisterInterfaceComponent(this);
+	Super::OnUnregister();
+}
+
 #if WITH_EDITOR
 void UUxtPinchSliderComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
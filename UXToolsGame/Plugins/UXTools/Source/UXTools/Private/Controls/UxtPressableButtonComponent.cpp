@@ -6,6 +6,7 @@
 #include "UXTools.h"
 
 #include "Input/UxtFarPointerComponent.h"
+#include "Input/UxtInputSubsystem.h"
 #include "Input/UxtNearPointerComponent.h"
 #include "Interactions/UxtInteractionUtils.h"
 #include "Utils/UxtMathUtilsFunctionLibrary.h"
@@ -94,6 +95,7 @@ void UUxtPressableButtonComponent::SetEnabled(bool Enabled)
 	if (Enabled && bIsDisabled)
 	{
 		bIsDisabled = false;
+		UUxtInputSubsystem::InvalidateFarTargets(GetOwner());
 		OnButtonEnabled.Broadcast(this);
 	}
 	else if (!Enabled && !bIsDisabled)
@@ -114,6 +116,7 @@ void UUxtPressableButtonComponent::SetEnabled(bool Enabled)
 		CurrentPushDistance = 0;
 
 		bIsDisabled = true;
+		UUxtInputSubsystem::InvalidateFarTargets(GetOwner());
 		OnButtonDisabled.Broadcast(this);
 	}
 }
@@ -198,6 +201,18 @@ void UUxtPressableButtonComponent::BeginPlay()
 	}
 }
 
+void UUxtPressableButtonComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtInputSubsystem::RegisterInterfaceComponent(this);
+}
+
+void UUxtPressableButtonComponent::OnUnregister()
+{
+	UUxtInputSubsystem::UnregisterInterfaceComponent(this);
+	Super::OnUnregister();
+}
+
 // Called every frame
 void UUxtPressableButtonComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
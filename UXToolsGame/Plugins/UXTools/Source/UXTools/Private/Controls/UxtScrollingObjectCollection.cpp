@@ -12,6 +12,7 @@
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Input/UxtFarPointerComponent.h"
+#include "Input/UxtInputSubsystem.h"
 #include "Input/UxtNearPointerComponent.h"
 #include "Interactions/UxtInteractionUtils.h"
 #include "Utils/UxtMathUtilsFunctionLibrary.h"
@@ -38,6 +39,13 @@ namespace
 
 const int32 ScrollingObjectCollectionMinTiers = 1;
 
+// Free motion is integrated at most this far per tick, so a long frame doesn't result in a burst of steps
+const float MaxScrollTimePerTick = 0.25f;
+// Lower limit of the scroll time step, to keep the number of steps per tick reasonable
+const float MinScrollTimeStep = 0.001f;
+// Distance from the snap location below which a snap without any velocity left finishes
+const float SnapSettleDistance = 0.001f;
+
 /**
  *
  */
@@ -49,20 +57,32 @@ UUxtScrollingObjectCollection::UUxtScrollingObjectCollection()
 	, CellWidth(3.2f)
 	, CellHeight(3.2f)
 	, ViewableArea(4)
+	, VirtualizationMargin(1)
 	, CollisionProfile(TEXT("UI"))
 	, bReleaseAtScrollBoundary(false)
 	, ScrollSmoothing(0.5f)
 	, VelocityDamping(0.04f)
 	, BounceSpringFactor(0.75f)
 	, SnapToStrength(0.0f)
+	, ScrollTimeStep(1.0f / 60.0f)
 	, Tiers(2)
 	, BoxComponent(nullptr)
+	, CollisionBounds(EForceInit::ForceInit)
+	, bCollisionBoundsValid(false)
 	, CollectionRoot(nullptr)
 	, Offset(0.0f)
 	, OffsetVelocity(0.0f)
 	, PaginationDelta(0.0f)
 	, PaginationOffset(0.0f)
 	, PaginationTime(0.0f)
+	, ScrollTimeAccumulator(0.0f)
+	, AppliedNetOffset(0.0f)
+	, bIsSettled(false)
+	, FirstVisibleItem(0)
+	, FirstNotVisibleItem(0)
+	, bVisibleItemRangeValid(false)
+	, NumVirtualItems(0)
+	, FirstBoundVirtualItem(0)
 #if WITH_EDITORONLY_DATA
 	, bCollectionInitializedInEditor(false)
 #endif // WITH_EDITORONLY_DATA
@@ -136,6 +156,44 @@ void UUxtScrollingObjectCollection::BeginPlay()
 	{
 		Actor->AttachToComponent(CollectionRoot, FAttachmentTransformRules::KeepWorldTransform);
 	}
+
+	// A data source may have been set before the collection root existed
+	if (IsVirtualized())
+	{
+		RefreshDataSource();
+		ConfigureBoxComponent();
+	}
+}
+
+void UUxtScrollingObjectCollection::OnRegister()
+{
+	Super::OnRegister();
+	UUxtInputSubsystem::RegisterInterfaceComponent(this);
+}
+
+void UUxtScrollingObjectCollection::OnUnregister()
+{
+	UUxtInputSubsystem::UnregisterInterfaceComponent(this);
+	Super::OnUnregister();
+}
+
+/**
+ *
+ */
+void UUxtScrollingObjectCollection::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Pooled actors are owned by the collection
+	ReleaseAllVirtualItems();
+	for (AActor* const Actor : FreeVirtualItemActors)
+	{
+		if (Actor)
+		{
+			Actor->Destroy();
+		}
+	}
+	FreeVirtualItemActors.Empty();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 /**
@@ -163,6 +221,13 @@ void UUxtScrollingObjectCollection::TickComponent(float DeltaTime, ELevelTick Ti
 
 	TickCollectionOffset(DeltaTime);
 	ResetCollectionVisibility();
+
+	// Nothing changes until the next interaction, pagination or change to the collection
+	if (HasSettled())
+	{
+		bIsSettled = true;
+		SetComponentTickEnabled(false);
+	}
 }
 
 void UUxtScrollingObjectCollection::DestroyComponent(bool bPromoteToChildred)
@@ -210,107 +275,130 @@ void UUxtScrollingObjectCollection::TickCollectionOffset(const float DeltaTime)
 		OffsetVelocity = FMath::Lerp(OffsetVelocity, (InteractionOffset - PrevInteractionOffset) / DeltaTime, 0.1f);
 		// update the previous value ready for next tick
 		PrevInteractionOffset = InteractionOffset;
+		// free motion starts with a whole step once the interaction ends
+		ScrollTimeAccumulator = 0.0f;
 	}
 	else
 	{
-		float MinimumValidOffset, MaximumValidOffset;
-		GetValidOffsetRange(&MinimumValidOffset, &MaximumValidOffset);
-
-		if (Offset < MinimumValidOffset)
+		// Free motion is integrated in fixed steps, so that it is the same regardless of frame rate
+		ScrollTimeAccumulator += FMath::Min(DeltaTime, MaxScrollTimePerTick);
+		const float TimeStep = FMath::Max(ScrollTimeStep, MinScrollTimeStep);
+		while (ScrollTimeAccumulator >= TimeStep)
 		{
-			const float ReboundVelocity = (MinimumValidOffset - Offset) * BounceSpringFactor;
-			OffsetVelocity += ReboundVelocity;
-
-			const float NextOffset = Offset + OffsetVelocity * DeltaTime;
-			if (OffsetVelocity > 0.0f && NextOffset >= MinimumValidOffset)
-			{
-				OffsetVelocity = 0.0f;
-				Offset = MinimumValidOffset;
-			}
-			else
-			{
-				Offset = NextOffset;
-			}
+			StepScrollPhysics(TimeStep);
+			ScrollTimeAccumulator -= TimeStep;
 		}
-		else if (Offset > MaximumValidOffset)
-		{
-			const float ReboundVelocity = (MaximumValidOffset - Offset) * BounceSpringFactor;
-			OffsetVelocity += ReboundVelocity;
+	}
 
-			const float NextOffset = Offset + OffsetVelocity * DeltaTime;
-			if (OffsetVelocity < 0.0f && NextOffset <= MaximumValidOffset)
-			{
-				OffsetVelocity = 0.0f;
-				Offset = MaximumValidOffset;
-			}
-			else
-			{
-				Offset = NextOffset;
-			}
-		}
+	// apply the calculated offset based on the InteractionOffset, this should be valid to do regardless
+	// of whether there is an active interaction or not.
+	const float NetOffset = GetCurrentNetOffset();
+	if (NetOffset != AppliedNetOffset)
+	{
+		CollectionRoot->SetRelativeLocation(
+			NetOffset * (ScrollDirection == EUxtScrollDirection::UpAndDown ? FVector::UpVector : FVector::RightVector));
+		AppliedNetOffset = NetOffset;
+	}
+}
 
-		// Is the Offset beyond valid extents, if so we want to be able to spring back
-		if (Offset < MinimumValidOffset)
-		{
-			const float ReboundVelocity = (MinimumValidOffset - Offset) * BounceSpringFactor;
-			OffsetVelocity += ReboundVelocity;
+/**
+ *
+ */
+void UUxtScrollingObjectCollection::StepScrollPhysics(const float TimeStep)
+{
+	float MinimumValidOffset, MaximumValidOffset;
+	GetValidOffsetRange(&MinimumValidOffset, &MaximumValidOffset);
 
-			const float NextOffset = Offset + OffsetVelocity * DeltaTime;
-			if (OffsetVelocity > 0.0f && NextOffset >= MinimumValidOffset)
-			{
-				OffsetVelocity = 0.0f;
-				Offset = MinimumValidOffset;
-			}
-			else
-			{
-				Offset = NextOffset;
-			}
-		}
-		else if (Offset > MaximumValidOffset)
-		{
-			const float ReboundVelocity = (MaximumValidOffset - Offset) * BounceSpringFactor;
-			OffsetVelocity += ReboundVelocity;
+	// Is the Offset beyond valid extents, if so we want to be able to spring back
+	if (Offset < MinimumValidOffset || Offset > MaximumValidOffset)
+	{
+		const float ValidOffset = FMath::Clamp(Offset, MinimumValidOffset, MaximumValidOffset);
+		const float ReboundVelocity = (ValidOffset - Offset) * BounceSpringFactor;
+		OffsetVelocity += ReboundVelocity;
 
-			const float NextOffset = Offset + OffsetVelocity * DeltaTime;
-			if (OffsetVelocity < 0.0f && NextOffset <= MaximumValidOffset)
-			{
-				OffsetVelocity = 0.0f;
-				Offset = MaximumValidOffset;
-			}
-			else
-			{
-				Offset = NextOffset;
-			}
+		// Stop at the valid extent once moving back towards it
+		const float NextOffset = Offset + OffsetVelocity * TimeStep;
+		if (OffsetVelocity * ReboundVelocity > 0.0f && (NextOffset - ValidOffset) * ReboundVelocity >= 0.0f)
+		{
+			OffsetVelocity = 0.0f;
+			Offset = ValidOffset;
 		}
 		else
 		{
-			// Offset to the nearest snap to location, i.e. the nearest cell boundary
-			const float SingleCellOffset = GetSingleCellOffset();
-			const float OffsetDeltaToSnap = (SingleCellOffset * FMath::RoundToFloat(Offset / SingleCellOffset)) - Offset;
-
-			// We will add to the offset and scale the velocity based on the strength of the snap to effect
-			// The result should be that we stick to the snap location if we don't already have enough velocity to take us past
-			// it and towards the next location. Note that a strength of 1.0f will result in an instant snap to the location and a zeroing
-			// of the velocity
-			Offset += OffsetDeltaToSnap * SnapToStrength;
-			OffsetVelocity = FMath::Lerp(OffsetVelocity, 0.0f, SnapToStrength);
-
-			// Update the offset with any residual velocity
-			Offset += OffsetVelocity * DeltaTime;
-
-			// Dampen the velocity. Zero the velocity below a threshold to prevent potentially ugly slow crawl when the numbers get very
-			// small.
-			if (FMath::Abs(OffsetVelocity = FMath::Lerp(OffsetVelocity, 0.0f, VelocityDamping)) < 0.0001f)
+			Offset = NextOffset;
+		}
+	}
+	else
+	{
+		// Offset to the nearest snap to location, i.e. the nearest cell boundary
+		const float OffsetDeltaToSnap = GetNearestSnapOffset() - Offset;
+
+		// We will add to the offset and scale the velocity based on the strength of the snap to effect
+		// The result should be that we stick to the snap location if we don't already have enough velocity to take us past
+		// it and towards the next location. Note that a strength of 1.0f will result in an instant snap to the location and a zeroing
+		// of the velocity
+		Offset += OffsetDeltaToSnap * SnapToStrength;
+		OffsetVelocity = FMath::Lerp(OffsetVelocity, 0.0f, SnapToStrength);
+
+		// Update the offset with any residual velocity
+		Offset += OffsetVelocity * TimeStep;
+
+		// Dampen the velocity. Zero the velocity below a threshold to prevent potentially ugly slow crawl when the numbers get very
+		// small.
+		if (FMath::Abs(OffsetVelocity = FMath::Lerp(OffsetVelocity, 0.0f, VelocityDamping)) < 0.0001f)
+		{
+			OffsetVelocity = 0.0f;
+
+			// Likewise finish the snap once it is close enough, so that the collection can settle
+			const float NearestSnapOffset = GetNearestSnapOffset();
+			if (SnapToStrength > 0.0f && FMath::Abs(NearestSnapOffset - Offset) < SnapSettleDistance)
 			{
-				OffsetVelocity = 0.0f;
+				Offset = NearestSnapOffset;
 			}
 		}
 	}
+}
 
-	// apply the calculated offset based on the InteractionOffset, this should be valid to do regardless
-	// of whether there is an active interaction or not.
-	CollectionRoot->SetRelativeLocation(
-		GetCurrentNetOffset() * (ScrollDirection == EUxtScrollDirection::UpAndDown ? FVector::UpVector : FVector::RightVector));
+/**
+ *
+ */
+float UUxtScrollingObjectCollection::GetNearestSnapOffset() const
+{
+	const float SingleCellOffset = GetSingleCellOffset();
+	return SingleCellOffset * FMath::RoundToFloat(Offset / SingleCellOffset);
+}
+
+/**
+ *
+ */
+bool UUxtScrollingObjectCollection::HasSettled() const
+{
+	if (PaginationDelta != 0.0f || IsActiveInteraction() || OffsetVelocity != 0.0f)
+	{
+		return false;
+	}
+
+	float MinimumValidOffset, MaximumValidOffset;
+	GetValidOffsetRange(&MinimumValidOffset, &MaximumValidOffset);
+	if (Offset < MinimumValidOffset || Offset > MaximumValidOffset)
+	{
+		return false;
+	}
+
+	return SnapToStrength <= 0.0f || Offset == GetNearestSnapOffset();
+}
+
+/**
+ *
+ */
+void UUxtScrollingObjectCollection::WakeUp()
+{
+	if (bIsSettled)
+	{
+		bIsSettled = false;
+		ScrollTimeAccumulator = 0.0f;
+		SetComponentTickEnabled(true);
+	}
 }
 
 /**
@@ -319,16 +407,14 @@ void UUxtScrollingObjectCollection::TickCollectionOffset(const float DeltaTime)
 void UUxtScrollingObjectCollection::InitializeCollection()
 {
 	Tiers = FMath::Max(Tiers, ScrollingObjectCollectionMinTiers); // Make sure no one sets 0;
-	const TArray<AActor*>& Actors = CollectAttachedActors();
 
-	// spin through attached actors and place them
-	// we fill actors in order, filling up 'tiers' first
+	// Axes and offsets of the collection layout, actors are placed in order filling up 'tiers' first
 	const float TierDir = -1.0f;
 	const float OrthoDir = -1.0f;
 
 	// If the @ScrollDirection property is set to LeftAndRight then all that needs to be done at the point
-	// is to swap the axis in which the offsets are applied, placement logic remains the same
-	// Use pointers to member to make this transparent within the loop below.
+	// is to swap the axis in which the offsets are applied, layout logic remains the same
+	// Use pointers to member to make this transparent when computing the collection properties below.
 	float FVector::*pTier = &FVector::Y;
 	float FVector::*pOrtho = &FVector::Z;
 	float TierOffset = TierDir * CellWidth;
@@ -346,29 +432,39 @@ void UUxtScrollingObjectCollection::InitializeCollection()
 	// Note: Rather than littering this class with asserts we will assert once here, this is not the only place this assumption is made.
 	check_validscrolldirection();
 
-	FVector ActorLocation = FVector::ZeroVector;
-
-	// Outer loop iterates through actor array, one tier at a time
-	for (int32 ActorIndex = 0; ActorIndex < Actors.Num(); ActorIndex += Tiers)
+	// Items of a data source are placed when they are bound to an actor
+	if (IsVirtualized())
+	{
+		ReleaseAllVirtualItems();
+	}
+	else
 	{
-		// Inner loop iterates through actors that should be placed within the tier
-		// but we need to account for the fact that we might not have enough actors to fill the tier
-		const int32 NumColumnsInRow = FMath::Min(Tiers, Actors.Num() - ActorIndex);
-		for (int32 ColumnIndex = 0; ColumnIndex < NumColumnsInRow; ++ColumnIndex)
+		const TArray<AActor*>& Actors = CollectAttachedActors();
+
+		// Actors only need to be placed again if something their placement depends on has changed
+		const FUxtScrollingCollectionLayout CurrentLayout = GetCurrentLayout();
+		if (CurrentLayout != Layout)
 		{
-			Actors[ActorIndex + ColumnIndex]->SetActorRelativeLocation(ActorLocation);
+			Layout = CurrentLayout;
+
+			// Items may have been replaced or moved, so all of them need their visibility and bounds updated
+			bVisibleItemRangeValid = false;
+			bCollisionBoundsValid = false;
 
-			// increment location offset in tier direction ready for the next actor
-			ActorLocation.*pTier += TierOffset;
+			// Same placement as virtual items get when they are bound to an actor
+			for (int32 ActorIndex = 0; ActorIndex < Actors.Num(); ++ActorIndex)
+			{
+				Actors[ActorIndex]->SetActorRelativeLocation(GetItemRelativeLocation(ActorIndex));
+			}
 		}
-		// reset location offset in tier direction, and increment tier orthogonal offset ready for the start of the next tier
-		ActorLocation.*pTier = 0.0f;
-		ActorLocation.*pOrtho += OrthoOffset;
 	}
 
 	// Collection properties may have changed to we need to update the visibility of those contained actors
 	ResetCollectionVisibility();
 
+	// The valid offset range may have changed, so the collection may need to bounce back into it
+	WakeUp();
+
 	// SetupCollection Properties for broadcast
 	FScrollingCollectionProperties Properties;
 
@@ -402,6 +498,48 @@ void UUxtScrollingObjectCollection::InitializeCollection()
 #endif // WITH_EDITORONLY_DATA
 }
 
+/**
+ *
+ */
+FUxtScrollingCollectionLayout UUxtScrollingObjectCollection::GetCurrentLayout() const
+{
+	FUxtScrollingCollectionLayout CurrentLayout;
+	CurrentLayout.Tiers = Tiers;
+	CurrentLayout.CellWidth = CellWidth;
+	CurrentLayout.CellHeight = CellHeight;
+	CurrentLayout.ScrollDirection = ScrollDirection;
+	CurrentLayout.NumItems = GetAttachedActors().Num();
+	CurrentLayout.SortRevision = GetSortRevision();
+	return CurrentLayout;
+}
+
+/**
+ *
+ */
+void UUxtScrollingObjectCollection::AppendActorToCollection(AActor* Actor)
+{
+	const int32 ItemIndex = GetAttachedActors().Num();
+	AppendAttachedActor(Actor);
+	Actor->SetActorRelativeLocation(GetItemRelativeLocation(ItemIndex));
+	Layout.NumItems = ItemIndex + 1;
+
+	const bool bHidden = (ItemIndex < FirstVisibleItem || ItemIndex >= FirstNotVisibleItem);
+	SetItemActorHidden(Actor, bHidden);
+
+	// Only items in the viewable area contribute to the collision bounds
+	if (!bHidden && bCollisionBoundsValid)
+	{
+		const bool bNonColliding = false;
+		CollisionBounds += UUxtMathUtilsFunctionLibrary::CalculateNestedBoundsInGivenSpace(
+			Actor->GetRootComponent(), GetComponentTransform().Inverse(), bNonColliding);
+		UpdateBoxComponentBounds();
+	}
+	else if (!bHidden)
+	{
+		ConfigureBoxComponent();
+	}
+}
+
 /**
  *
  */
@@ -421,18 +559,62 @@ void UUxtScrollingObjectCollection::ResetCollectionVisibility()
 	int FirstVisible = FMath::Max(FirstVisibleRow, 0) * Tiers;
 	int FirstNotVisible = FMath::Max(FirstNotVisibleRow, 0) * Tiers;
 
-	const TArray<AActor*>& Actors = GetAttachedActors();
-	for (int i = 0; i < Actors.Num(); ++i)
+	// Most frames don't scroll far enough for any item to enter or leave the viewable area
+	if (bVisibleItemRangeValid && FirstVisible == FirstVisibleItem && FirstNotVisible == FirstNotVisibleItem)
 	{
-		const bool bHidden = (i < FirstVisible || i >= FirstNotVisible);
-		Actors[i]->SetActorHiddenInGame(bHidden);
-		Actors[i]->SetActorTickEnabled(!bHidden);
-		Actors[i]->SetActorEnableCollision(!bHidden);
+		return;
+	}
+
+	if (IsVirtualized())
+	{
+		UpdateVirtualItems(FirstVisible, FirstNotVisible);
+	}
+	else if (!bVisibleItemRangeValid)
+	{
+		const TArray<AActor*>& Actors = GetAttachedActors();
+		for (int i = 0; i < Actors.Num(); ++i)
+		{
+			SetItemActorHidden(Actors[i], i < FirstVisible || i >= FirstNotVisible);
+		}
+	}
+	else
+	{
+		// Only actors that crossed the boundary of the visible range need to be updated
+		const TArray<AActor*>& Actors = GetAttachedActors();
+		const int32 NumActors = Actors.Num();
+		for (int i = FirstVisibleItem; i < FMath::Min(FirstNotVisibleItem, NumActors); ++i)
+		{
+			if (i < FirstVisible || i >= FirstNotVisible)
+			{
+				SetItemActorHidden(Actors[i], true);
+			}
+		}
+		for (int i = FirstVisible; i < FMath::Min(FirstNotVisible, NumActors); ++i)
+		{
+			if (i < FirstVisibleItem || i >= FirstNotVisibleItem)
+			{
+				SetItemActorHidden(Actors[i], false);
+			}
+		}
+	}
+
+	FirstVisibleItem = FirstVisible;
+	FirstNotVisibleItem = FirstNotVisible;
+	bVisibleItemRangeValid = true;
+}
+
+/**
+ *
+ */
+void UUxtScrollingObjectCollection::SetItemActorHidden(AActor* Actor, bool bHidden) const
+{
+	Actor->SetActorHiddenInGame(bHidden);
+	Actor->SetActorTickEnabled(!bHidden);
+	Actor->SetActorEnableCollision(!bHidden);
 
 #if WITH_EDITORONLY_DATA
-		Actors[i]->SetIsTemporarilyHiddenInEditor(bHidden);
+	Actor->SetIsTemporarilyHiddenInEditor(bHidden);
 #endif // WITH_EDITORONLY_DATA
-	}
 }
 
 /**
@@ -462,34 +644,48 @@ void UUxtScrollingObjectCollection::ConfigureBoxComponent()
 
 		// Expand a bounding box to encapsulate all of the attached actors that are currently
 		// within the viewable area (we can assume that all actors with collision enabled are included)
-		// we are operating in component local space
-		FBox BoundingBox(EForceInit::ForceInit);
-		const FTransform& WorldToLocal = GetComponentTransform().Inverse();
-		for (AActor* const Actor : GetAttachedActors())
+		// we are operating in component local space.
+		// The bounds are kept until the items are placed again, as calculating them visits every component of every item.
+		if (!bCollisionBoundsValid)
 		{
-			if (Actor->GetActorEnableCollision())
+			CollisionBounds.Init();
+			const FTransform& WorldToLocal = GetComponentTransform().Inverse();
+			for (AActor* const Actor : IsVirtualized() ? BoundVirtualItemActors : GetAttachedActors())
 			{
-				const bool bNonColliding = false;
-				BoundingBox +=
-					UUxtMathUtilsFunctionLibrary::CalculateNestedBoundsInGivenSpace(Actor->GetRootComponent(), WorldToLocal, bNonColliding);
+				if (Actor->GetActorEnableCollision())
+				{
+					const bool bNonColliding = false;
+					CollisionBounds += UUxtMathUtilsFunctionLibrary::CalculateNestedBoundsInGivenSpace(
+						Actor->GetRootComponent(), WorldToLocal, bNonColliding);
+				}
 			}
+			bCollisionBoundsValid = true;
 		}
 
-		// Expand the front face of the bounds by a small percentage
-		const float Min = BoundingBox.Min.X;
-		const float Max = BoundingBox.Max.X;
-		BoundingBox.Max.X = FMath::Lerp(Min, Max, 1.1f);
+		UpdateBoxComponentBounds();
+	}
+}
 
-		BoxComponent->SetWorldTransform(FTransform(BoundingBox.GetCenter()) * GetComponentTransform());
-		BoxComponent->SetBoxExtent(BoundingBox.GetExtent());
-		BoxComponent->SetCollisionProfileName(CollisionProfile);
+/**
+ *
+ */
+void UUxtScrollingObjectCollection::UpdateBoxComponentBounds()
+{
+	// Expand the front face of the bounds by a small percentage
+	FBox BoundingBox = CollisionBounds;
+	const float Min = BoundingBox.Min.X;
+	const float Max = BoundingBox.Max.X;
+	BoundingBox.Max.X = FMath::Lerp(Min, Max, 1.1f);
 
-		// Make sure to re enable collision on the box component
-		BoxComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	BoxComponent->SetWorldTransform(FTransform(BoundingBox.GetCenter()) * GetComponentTransform());
+	BoxComponent->SetBoxExtent(BoundingBox.GetExtent());
+	BoxComponent->SetCollisionProfileName(CollisionProfile);
 
-		// Cache the extents for use in a workaround in OnBeginPoke_Implementation and OnEndPoke_Implementation
-		BoxComponentExtents = BoundingBox.GetExtent();
-	}
+	// Make sure to re enable collision on the box component
+	BoxComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+
+	// Cache the extents for use in a workaround in OnBeginPoke_Implementation and OnEndPoke_Implementation
+	BoxComponentExtents = BoundingBox.GetExtent();
 }
 
 /**
@@ -514,7 +710,7 @@ float UUxtScrollingObjectCollection::GetTierOffsetFromLocation(const FVector Loc
  */
 int UUxtScrollingObjectCollection::GetNumberOfRowsInCollection() const
 {
-	const int NoofActors = GetAttachedActors().Num();
+	const int NoofActors = GetNumberOfItemsInCollection();
 	int NoofRows = (NoofActors / Tiers);
 	// A remainder means that we need an extra row.
 	if (NoofActors % Tiers > 0)
@@ -606,19 +802,203 @@ void UUxtScrollingObjectCollection::MoveByItems(
 	PaginationTime = bAnimate ? 0.0f : PaginationCurve.GetRichCurve()->GetLastKey().Time;
 
 	OnPaginationComplete = Callback;
+	WakeUp();
 }
 
 void UUxtScrollingObjectCollection::AddActorToCollection(AActor* ActorToAdd)
 {
 	if (ActorToAdd)
 	{
+		// A new actor goes at the end of an unsorted collection, so the other actors stay where they are.
+		// Otherwise the collection is initialized again, which collects, sorts and places all attached actors.
+		const bool bCanAppend = CollectionRoot && !IsVirtualized() && !IsSorted() && Layout == GetCurrentLayout() &&
+								!ActorToAdd->IsAttachedTo(GetOwner());
+
 		ActorToAdd->AttachToComponent(CollectionRoot, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
 		ActorToAdd->SetActorRelativeTransform(FTransform::Identity);
-		InitializeCollection();
+		if (bCanAppend)
+		{
+			AppendActorToCollection(ActorToAdd);
+		}
+		else
+		{
+			// The actor was just snapped to the collection root, so all actors are placed again even if the layout matches
+			Layout = FUxtScrollingCollectionLayout();
+			InitializeCollection();
+			ConfigureBoxComponent();
+		}
+	}
+}
+
+void UUxtScrollingObjectCollection::SetDataSource(
+	TSubclassOf<AActor> ItemClass, const FUxtScrollingObjectCollectionGetItemCount& GetItemCount,
+	const FUxtScrollingObjectCollectionBindItem& BindItem)
+{
+	// Actors of the previous data source can't be reused if the class changes
+	ReleaseAllVirtualItems();
+	if (ItemClass != VirtualItemClass)
+	{
+		for (AActor* const Actor : FreeVirtualItemActors)
+		{
+			if (Actor)
+			{
+				Actor->Destroy();
+			}
+		}
+		FreeVirtualItemActors.Empty();
+	}
+
+	VirtualItemClass = ItemClass;
+	GetVirtualItemCount = GetItemCount;
+	BindVirtualItem = BindItem;
+
+	// Before BeginPlay the collection is refreshed once the collection root exists
+	if (CollectionRoot)
+	{
+		RefreshDataSource();
 		ConfigureBoxComponent();
 	}
 }
 
+void UUxtScrollingObjectCollection::RefreshDataSource()
+{
+	NumVirtualItems = GetVirtualItemCount.IsBound() ? FMath::Max(GetVirtualItemCount.Execute(), 0) : 0;
+
+	ReleaseAllVirtualItems();
+	ResetCollectionVisibility();
+	WakeUp();
+}
+
+AActor* UUxtScrollingObjectCollection::GetItemActor(int32 ItemIndex) const
+{
+	if (IsVirtualized())
+	{
+		const int32 BoundIndex = ItemIndex - FirstBoundVirtualItem;
+		return BoundVirtualItemActors.IsValidIndex(BoundIndex) ? BoundVirtualItemActors[BoundIndex] : nullptr;
+	}
+
+	const TArray<AActor*>& Actors = GetAttachedActors();
+	return Actors.IsValidIndex(ItemIndex) ? Actors[ItemIndex] : nullptr;
+}
+
+void UUxtScrollingObjectCollection::UpdateVirtualItems(int32 FirstVisible, int32 FirstNotVisible)
+{
+	if (!CollectionRoot)
+	{
+		return;
+	}
+
+	const int32 Margin = FMath::Max(VirtualizationMargin, 0) * Tiers;
+	const int32 FirstBound = FMath::Clamp(FirstVisible - Margin, 0, NumVirtualItems);
+	const int32 FirstNotBound = FMath::Clamp(FirstNotVisible + Margin, FirstBound, NumVirtualItems);
+	const int32 PrevFirstBound = FirstBoundVirtualItem;
+	const int32 PrevFirstNotBound = FirstBoundVirtualItem + BoundVirtualItemActors.Num();
+
+	// Release actors of items that left the bound range first, so they can be reused for items that entered it
+	for (int32 ItemIndex = PrevFirstBound; ItemIndex < PrevFirstNotBound; ++ItemIndex)
+	{
+		if (ItemIndex < FirstBound || ItemIndex >= FirstNotBound)
+		{
+			ReleaseVirtualItemActor(BoundVirtualItemActors[ItemIndex - PrevFirstBound]);
+		}
+	}
+
+	NextBoundVirtualItemActors.Reset();
+	for (int32 ItemIndex = FirstBound; ItemIndex < FirstNotBound; ++ItemIndex)
+	{
+		AActor* Actor = nullptr;
+		const bool bIsNewActor = (ItemIndex < PrevFirstBound || ItemIndex >= PrevFirstNotBound);
+		if (!bIsNewActor)
+		{
+			Actor = BoundVirtualItemActors[ItemIndex - PrevFirstBound];
+		}
+		else
+		{
+			Actor = AcquireVirtualItemActor();
+			Actor->SetActorRelativeLocation(GetItemRelativeLocation(ItemIndex));
+			BindVirtualItem.ExecuteIfBound(ItemIndex, Actor);
+		}
+
+		// Items in the margin are bound but hidden, the same way attached actors outside of the viewable area are.
+		// Actors kept from the last update only need to change if they crossed the boundary of the visible range.
+		const bool bHidden = (ItemIndex < FirstVisible || ItemIndex >= FirstNotVisible);
+		const bool bWasHidden = (ItemIndex < FirstVisibleItem || ItemIndex >= FirstNotVisibleItem);
+		if (bIsNewActor || !bVisibleItemRangeValid || bHidden != bWasHidden)
+		{
+			SetItemActorHidden(Actor, bHidden);
+		}
+
+		NextBoundVirtualItemActors.Add(Actor);
+	}
+
+	Swap(BoundVirtualItemActors, NextBoundVirtualItemActors);
+	FirstBoundVirtualItem = FirstBound;
+}
+
+AActor* UUxtScrollingObjectCollection::AcquireVirtualItemActor()
+{
+	if (FreeVirtualItemActors.Num() > 0)
+	{
+		return FreeVirtualItemActors.Pop(false);
+	}
+
+	FActorSpawnParameters Params;
+	Params.Owner = GetOwner();
+	AActor* const Actor = GetWorld()->SpawnActor<AActor>(VirtualItemClass, Params);
+	check(Actor);
+	Actor->AttachToComponent(CollectionRoot, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	return Actor;
+}
+
+void UUxtScrollingObjectCollection::ReleaseVirtualItemActor(AActor* Actor)
+{
+	// Actors may have been destroyed externally
+	if (!Actor)
+	{
+		return;
+	}
+
+	SetItemActorHidden(Actor, true);
+	FreeVirtualItemActors.Add(Actor);
+}
+
+void UUxtScrollingObjectCollection::ReleaseAllVirtualItems()
+{
+	for (AActor* const Actor : BoundVirtualItemActors)
+	{
+		ReleaseVirtualItemActor(Actor);
+	}
+	BoundVirtualItemActors.Reset();
+	FirstBoundVirtualItem = 0;
+	bVisibleItemRangeValid = false;
+	bCollisionBoundsValid = false;
+}
+
+FVector UUxtScrollingObjectCollection::GetItemRelativeLocation(int32 ItemIndex) const
+{
+	// Items are placed in order, filling up tiers first
+	const float TierDir = -1.0f;
+	const float OrthoDir = -1.0f;
+
+	FVector Location = FVector::ZeroVector;
+	if (ScrollDirection == EUxtScrollDirection::LeftAndRight)
+	{
+		Location.Z = TierDir * CellHeight * (ItemIndex % Tiers);
+		Location.Y = OrthoDir * CellWidth * (ItemIndex / Tiers);
+	}
+	else
+	{
+		Location.Y = TierDir * CellWidth * (ItemIndex % Tiers);
+		Location.Z = OrthoDir * CellHeight * (ItemIndex / Tiers);
+	}
+	return Location;
+}
+
+int32 UUxtScrollingObjectCollection::GetNumberOfItemsInCollection() const
+{
+	return IsVirtualized() ? NumVirtualItems : GetAttachedActors().Num();
+}
+
 /**
  *
  */
@@ -679,12 +1059,12 @@ void UUxtScrollingObjectCollection::CheckScrollOrClick()
 
 			if (ButtonIndex != -1)
 			{
-				const TArray<AActor*>& Actors = GetAttachedActors();
-				if (Actors.IsValidIndex(ButtonIndex) && Actors[ButtonIndex])
+				AActor* const Actor = GetItemActor(ButtonIndex);
+				if (Actor)
 				{
-					if (Actors[ButtonIndex]->GetClass()->ImplementsInterface(UUxtCollectionObject::StaticClass()))
+					if (Actor->GetClass()->ImplementsInterface(UUxtCollectionObject::StaticClass()))
 					{
-						PokeTarget = IUxtCollectionObject::Execute_GetPokeTarget(Actors[ButtonIndex]);
+						PokeTarget = IUxtCollectionObject::Execute_GetPokeTarget(Actor);
 						if (PokeTarget)
 						{
 							IUxtPokeHandler::Execute_OnBeginPoke(PokeTarget.GetObject(), Pointer);
@@ -710,12 +1090,12 @@ void UUxtScrollingObjectCollection::CheckScrollOrClickFarPointer()
 
 			if (ButtonIndex != -1)
 			{
-				const TArray<AActor*>& Actors = GetAttachedActors();
-				if (Actors.IsValidIndex(ButtonIndex) && Actors[ButtonIndex])
+				AActor* const Actor = GetItemActor(ButtonIndex);
+				if (Actor)
 				{
-					if (Actors[ButtonIndex]->GetClass()->ImplementsInterface(UUxtCollectionObject::StaticClass()))
+					if (Actor->GetClass()->ImplementsInterface(UUxtCollectionObject::StaticClass()))
 					{
-						FarTarget = IUxtCollectionObject::Execute_GetFarTarget(Actors[ButtonIndex]);
+						FarTarget = IUxtCollectionObject::Execute_GetFarTarget(Actor);
 						if (FarTarget)
 						{
 							IUxtFarHandler::Execute_OnFarPressed(FarTarget.GetObject(), Pointer);
@@ -784,6 +1164,7 @@ void UUxtScrollingObjectCollection::OnBeginPoke_Implementation(UUxtNearPointerCo
 		// otherwise things start to get quite messy. Events will be passed to objects contained by the
 		// collection if they implement the interface IUxtCollectionObject.
 		Pointer->SetFocusLocked(true);
+		WakeUp();
 
 		FVector LocalSpaceLocation = LocationWorldToLocal(Pointer->GetGrabPointerTransform().GetLocation());
 		InteractionOrigin = GetScrollOffsetFromLocation(LocalSpaceLocation);
@@ -903,6 +1284,7 @@ void UUxtScrollingObjectCollection::OnFarPressed_Implementation(UUxtFarPointerCo
 		// otherwise things start to get quite messy. Events will be passed to objects contained by the
 		// collection if they implement the interface IUxtCollectionObject.
 		Pointer->SetFocusLocked(true);
+		WakeUp();
 
 		FVector LocalSpaceLocation = LocationWorldToLocal(Pointer->GetPointerOrigin());
 		InteractionOrigin = GetScrollOffsetFromLocation(LocalSpaceLocation);
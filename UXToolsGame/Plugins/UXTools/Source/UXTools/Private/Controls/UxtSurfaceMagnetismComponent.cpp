@@ -6,6 +6,7 @@
 #include "DrawDebugHelpers.h"
 
 #include "GameFramework/Actor.h"
+#include "Input/UxtInputSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Utils/UxtFunctionLibrary.h"
@@ -27,6 +28,9 @@ UPrimitiveComponent* UUxtSurfaceMagnetismComponent::GetTargetComponent() const
 void UUxtSurfaceMagnetismComponent::SetTargetComponent(UPrimitiveComponent* Target)
 {
 	TargetComponent.OverrideComponent = Target;
+
+	// Far focusable primitives depend on the target
+	UUxtInputSubsystem::InvalidateFarTargets(GetOwner());
 }
 
 // Called every frame
@@ -53,6 +57,18 @@ void UUxtSurfaceMagnetismComponent::BeginPlay()
 	}
 }
 
+void UUxtSurfaceMagnetismComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtInputSubsystem::RegisterInterfaceComponent(this);
+}
+
+void UUxtSurfaceMagnetismComponent::OnUnregister()
+{
+	UUxtInputSubsystem::UnregisterInterfaceComponent(this);
+	Super::OnUnregister();
+}
+
 bool UUxtSurfaceMagnetismComponent::CanHandleFar_Implementation(UPrimitiveComponent* Primitive) const
 {
 	return Primitive == GetTargetComponent();
@@ -96,7 +112,21 @@ void UUxtSurfaceMagnetismComponent::TraceAndSetActorLocation(FVector Start, FVec
 		QueryParams.bTraceComplex = false;
 		QueryParams.AddIgnoredComponent(Target);
 
-		if (GetWorld()->LineTraceSingleByChannel(Hit, Start, End, TraceChannel, QueryParams))
+		bool bHit;
+		const UUxtFarPointerComponent* FarPointer = FarPointerWeak.Get();
+		if (FarPointer && FarPointer->bAsyncTrace)
+		{
+			// Queue the ray of the extrapolated pointer pose, its result is used in the next frame
+			const FTransform QueuePose = FarPointer->GetAsyncTracePose();
+			const FVector QueueEnd = QueuePose.GetLocation() + QueuePose.GetRotation().GetForwardVector() * TraceDistance;
+			bHit = SurfaceTrace.TraceAsync(GetWorld(), Hit, Start, End, QueuePose.GetLocation(), QueueEnd, TraceChannel, QueryParams);
+		}
+		else
+		{
+			bHit = SurfaceTrace.Trace(GetWorld(), Hit, Start, End, TraceChannel, QueryParams);
+		}
+
+		if (bHit)
 		{
 			TargetLocation = Hit.Location + (ImpactNormalOffset * Hit.ImpactNormal);
 			TargetRotation = UKismetMathLibrary::MakeRotFromX(Hit.ImpactNormal);
@@ -6,6 +6,7 @@
 #include "UXTools.h"
 
 #include "Input/UxtFarPointerComponent.h"
+#include "Input/UxtInputSubsystem.h"
 #include "Input/UxtNearPointerComponent.h"
 #include "Interactions/UxtInteractionUtils.h"
 
@@ -19,6 +20,7 @@ void UUxtTouchableVolumeComponent::SetEnabled(bool Enabled)
 	if (Enabled && bIsDisabled)
 	{
 		bIsDisabled = false;
+		UUxtInputSubsystem::InvalidateFarTargets(GetOwner());
 		OnVolumeEnabled.Broadcast(this);
 	}
 	else if (!Enabled && !bIsDisabled)
@@ -32,10 +34,36 @@ void UUxtTouchableVolumeComponent::SetEnabled(bool Enabled)
 		PokePointers.Empty();
 
 		bIsDisabled = true;
+		UUxtInputSubsystem::InvalidateFarTargets(GetOwner());
 		OnVolumeDisabled.Broadcast(this);
 	}
 }
 
+int32 UUxtTouchableVolumeComponent::GetInteractionMode() const
+{
+	return InteractionMode;
+}
+
+void UUxtTouchableVolumeComponent::SetInteractionMode(int32 Flags)
+{
+	if (Flags != InteractionMode)
+	{
+		InteractionMode = Flags;
+		UUxtInputSubsystem::InvalidateFarTargets(GetOwner());
+	}
+}
+
+const TSet<UPrimitiveComponent*>& UUxtTouchableVolumeComponent::GetTouchablePrimitives() const
+{
+	return TouchablePrimitives;
+}
+
+void UUxtTouchableVolumeComponent::SetTouchablePrimitives(const TSet<UPrimitiveComponent*>& Primitives)
+{
+	TouchablePrimitives = Primitives;
+	UUxtInputSubsystem::InvalidateFarTargets(GetOwner());
+}
+
 // Called when the game starts
 void UUxtTouchableVolumeComponent::BeginPlay()
 {
@@ -66,6 +94,18 @@ void UUxtTouchableVolumeComponent::BeginPlay()
 	}
 }
 
+void UUxtTouchableVolumeComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtInputSubsystem::RegisterInterfaceComponent(this);
+}
+
+void UUxtTouchableVolumeComponent::OnUnregister()
+{
+	UUxtInputSubsystem::UnregisterInterfaceComponent(this);
+	Super::OnUnregister();
+}
+
 bool UUxtTouchableVolumeComponent::GetClosestPoint_Implementation(
 	const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutClosestPoint, FVector& OutNormal) const
 {
@@ -6,6 +6,7 @@
 #include "Framework/Application/SlateApplication.h"
 #include "Framework/Application/SlateUser.h"
 #include "Input/UxtFarPointerComponent.h"
+#include "Input/UxtInputSubsystem.h"
 #include "Input/UxtNearPointerComponent.h"
 #include "Input/UxtPointerComponent.h"
 #include "Interactions/UxtInteractionUtils.h"
@@ -35,6 +36,18 @@ void UUxtWidgetComponent::BeginPlay()
 	VirtualUser = FSlateApplication::Get().FindOrCreateVirtualUser(VirtualUserIndex);
 }
 
+void UUxtWidgetComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtInputSubsystem::RegisterInterfaceComponent(this);
+}
+
+void UUxtWidgetComponent::OnUnregister()
+{
+	UUxtInputSubsystem::UnregisterInterfaceComponent(this);
+	Super::OnUnregister();
+}
+
 bool UUxtWidgetComponent::IsPokeFocusable_Implementation(const UPrimitiveComponent* Primitive) const
 {
 	return Cast<UWidgetComponent>(Primitive) != nullptr;
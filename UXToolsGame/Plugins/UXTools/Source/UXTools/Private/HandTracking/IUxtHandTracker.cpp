@@ -30,6 +30,41 @@ public:
 	virtual bool GetIsSelectPressed(EControllerHand Hand, bool& OutIsSelectPressed) const override { return false; }
 };
 
+namespace
+{
+	/** Hand tracker used in place of the registered modular feature, if set. */
+	IUxtHandTracker* OverrideHandTracker = nullptr;
+} // namespace
+
+void FUxtHandSnapshot::CopyFromMotionControllerData(const FXRMotionControllerData& MotionControllerData)
+{
+	FrameId = GFrameCounter;
+	TrackingStatus = MotionControllerData.bValid ? MotionControllerData.TrackingStatus : ETrackingStatus::NotTracked;
+	bHasPointerPose = MotionControllerData.bValid;
+	bHasGripPose = MotionControllerData.bValid;
+	bHasJoints = MotionControllerData.DeviceVisualType == EXRVisualType::Hand && MotionControllerData.bValid;
+
+	if (MotionControllerData.bValid)
+	{
+		PointerOrientation = MotionControllerData.AimRotation;
+		PointerPosition = MotionControllerData.AimPosition;
+		GripOrientation = MotionControllerData.GripRotation;
+		GripPosition = MotionControllerData.GripPosition;
+	}
+
+	if (bHasJoints)
+	{
+		check(
+			MotionControllerData.HandKeyPositions.Num() == EHandKeypointCount &&
+			MotionControllerData.HandKeyRotations.Num() == EHandKeypointCount &&
+			MotionControllerData.HandKeyRadii.Num() == EHandKeypointCount);
+
+		FMemory::Memcpy(JointOrientations, MotionControllerData.HandKeyRotations.GetData(), sizeof(JointOrientations));
+		FMemory::Memcpy(JointPositions, MotionControllerData.HandKeyPositions.GetData(), sizeof(JointPositions));
+		FMemory::Memcpy(JointRadii, MotionControllerData.HandKeyRadii.GetData(), sizeof(JointRadii));
+	}
+}
+
 FName IUxtHandTracker::GetModularFeatureName()
 {
 	static FName FeatureName = FName(TEXT("UxtHandTracker"));
@@ -38,6 +73,11 @@ FName IUxtHandTracker::GetModularFeatureName()
 
 IUxtHandTracker& IUxtHandTracker::Get()
 {
+	if (OverrideHandTracker)
+	{
+		return *OverrideHandTracker;
+	}
+
 	// Fallback implementation if modular feature is not registered
 	static FDummyHandTracker DummyHandTracker;
 
@@ -51,3 +91,67 @@ IUxtHandTracker& IUxtHandTracker::Get()
 
 	return DummyHandTracker;
 }
+
+void IUxtHandTracker::SetOverride(IUxtHandTracker* HandTracker)
+{
+	check(IsInGameThread());
+	OverrideHandTracker = HandTracker;
+}
+
+IUxtHandTracker* IUxtHandTracker::GetOverride()
+{
+	return OverrideHandTracker;
+}
+
+bool IUxtHandTracker::GetPredictedPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	return GetPointerPose(Hand, OutOrientation, OutPosition);
+}
+
+const FUxtHandSnapshot& IUxtHandTracker::GetHandSnapshot(EControllerHand Hand) const
+{
+	check(IsInGameThread());
+
+	// Trackers poll their state at the beginning of the frame, so the individual getters only need to be called once per frame
+	const int32 HandIndex = Hand == EControllerHand::Left ? 0 : 1;
+	FUxtHandSnapshot& Snapshot = FallbackSnapshots[HandIndex];
+	if (!bFallbackSnapshotValid[HandIndex] || Snapshot.FrameId != GFrameCounter)
+	{
+		FillHandSnapshot(Hand, Snapshot);
+		bFallbackSnapshotValid[HandIndex] = true;
+	}
+	return Snapshot;
+}
+
+void IUxtHandTracker::InvalidateHandSnapshots() const
+{
+	bFallbackSnapshotValid[0] = false;
+	bFallbackSnapshotValid[1] = false;
+}
+
+bool IUxtHandTracker::ReadPublishedHandSnapshot(EControllerHand Hand, FUxtHandSnapshot& OutSnapshot) const
+{
+	if (IsInGameThread())
+	{
+		OutSnapshot = GetHandSnapshot(Hand);
+		return true;
+	}
+	return false;
+}
+
+void IUxtHandTracker::FillHandSnapshot(EControllerHand Hand, FUxtHandSnapshot& OutSnapshot) const
+{
+	OutSnapshot.FrameId = GFrameCounter;
+	OutSnapshot.TrackingStatus = GetTrackingStatus(Hand);
+
+	OutSnapshot.bHasJoints = true;
+	for (int32 iJoint = 0; iJoint < EHandKeypointCount && OutSnapshot.bHasJoints; ++iJoint)
+	{
+		OutSnapshot.bHasJoints = GetJointState(
+			Hand, (EHandKeypoint)iJoint, OutSnapshot.JointOrientations[iJoint], OutSnapshot.JointPositions[iJoint],
+			OutSnapshot.JointRadii[iJoint]);
+	}
+
+	OutSnapshot.bHasPointerPose = GetPointerPose(Hand, OutSnapshot.PointerOrientation, OutSnapshot.PointerPosition);
+	OutSnapshot.bHasGripPose = GetGripPose(Hand, OutSnapshot.GripOrientation, OutSnapshot.GripPosition);
+}
@@ -0,0 +1,476 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HandTracking/UxtHandTrackingRecording.h"
+
+#include "UXTools.h"
+
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/BufferReader.h"
+
+namespace
+{
+	/** "UXHT" in little endian byte order. */
+	const uint32 RecordingMagic = 0x54485855;
+
+	/** Increase when the frame layout changes, older recordings are rejected. */
+	const uint32 RecordingVersion = 3;
+
+	/** Recordings are little endian regardless of the platform that wrote them. */
+	const bool bRecordingByteSwapping = !PLATFORM_LITTLE_ENDIAN;
+
+	struct FRecordingHeader
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+
+		/** Serialized size of a frame record, guards against layout differences between the recording and replaying builds. */
+		uint32 FrameSize = 0;
+
+		friend FArchive& operator<<(FArchive& Ar, FRecordingHeader& Header)
+		{
+			return Ar << Header.Magic << Header.Version << Header.FrameSize;
+		}
+	};
+
+	enum ERecordedHandFlags : uint8
+	{
+		IsHandController = 1 << 0,
+		HasJoints = 1 << 1,
+		HasPointerPose = 1 << 2,
+		HasGrabState = 1 << 3,
+		IsGrabbing = 1 << 4,
+		HasSelectState = 1 << 5,
+		IsSelectPressed = 1 << 6,
+		HasGripPose = 1 << 7,
+	};
+
+	struct FRecordedHand
+	{
+		FQuat JointOrientations[EHandKeypointCount];
+		FVector JointPositions[EHandKeypointCount];
+		float JointRadii[EHandKeypointCount];
+
+		FQuat PointerOrientation;
+		FVector PointerPosition;
+
+		FQuat GripOrientation;
+		FVector GripPosition;
+
+		uint8 TrackingStatus;
+		uint8 Flags;
+
+		friend FArchive& operator<<(FArchive& Ar, FRecordedHand& Hand)
+		{
+			for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+			{
+				Ar << Hand.JointOrientations[Joint] << Hand.JointPositions[Joint] << Hand.JointRadii[Joint];
+			}
+
+			return Ar << Hand.PointerOrientation << Hand.PointerPosition << Hand.GripOrientation << Hand.GripPosition
+					  << Hand.TrackingStatus << Hand.Flags;
+		}
+	};
+
+	struct FRecordedFrame
+	{
+		double Time;
+
+		FQuat HeadOrientation;
+		FVector HeadPosition;
+
+		FRecordedHand Hands[2];
+
+		friend FArchive& operator<<(FArchive& Ar, FRecordedFrame& Frame)
+		{
+			return Ar << Frame.Time << Frame.HeadOrientation << Frame.HeadPosition << Frame.Hands[0] << Frame.Hands[1];
+		}
+	};
+
+	/** Serialized sizes, every frame record has the same size so that frames can be found without parsing the ones before. */
+	const int64 QuatSize = 4 * sizeof(float);
+	const int64 VectorSize = 3 * sizeof(float);
+	const int64 RecordedHandSize =
+		EHandKeypointCount * (QuatSize + VectorSize + sizeof(float)) + 2 * (QuatSize + VectorSize) + 2 * sizeof(uint8);
+	const int64 RecordedFrameSize = sizeof(double) + QuatSize + VectorSize + 2 * RecordedHandSize;
+	const int64 RecordingHeaderSize = 3 * sizeof(uint32);
+
+	EControllerHand GetHand(int32 HandIndex)
+	{
+		return HandIndex == 0 ? EControllerHand::Left : EControllerHand::Right;
+	}
+
+	int32 GetHandIndex(EControllerHand Hand)
+	{
+		return Hand == EControllerHand::Left ? 0 : 1;
+	}
+
+	void ReadRecordedFrame(const uint8* FrameData, int32 FrameIndex, FRecordedFrame& OutFrame)
+	{
+		FBufferReader Reader(const_cast<uint8*>(FrameData + FrameIndex * RecordedFrameSize), RecordedFrameSize, false);
+		Reader.SetByteSwapping(bRecordingByteSwapping);
+		Reader << OutFrame;
+	}
+
+	/** Read only the time of a frame, which is the first field of the record. */
+	double ReadRecordedFrameTime(const uint8* FrameData, int32 FrameIndex)
+	{
+		double Time = 0.0;
+		FBufferReader Reader(const_cast<uint8*>(FrameData + FrameIndex * RecordedFrameSize), sizeof(Time), false);
+		Reader.SetByteSwapping(bRecordingByteSwapping);
+		Reader << Time;
+		return Time;
+	}
+} // namespace
+
+FUxtHandTrackingRecorder::~FUxtHandTrackingRecorder()
+{
+	Close();
+}
+
+bool FUxtHandTrackingRecorder::Open(const FString& Filename)
+{
+	Close();
+
+	Writer.Reset(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!Writer)
+	{
+		UE_LOG(UXTools, Warning, TEXT("Could not create hand tracking recording '%s'."), *Filename);
+		return false;
+	}
+
+	Writer->SetByteSwapping(bRecordingByteSwapping);
+
+	// The header does not contain the frame count, which is derived from the file size. A recording that was not closed,
+	// e.g. because the application crashed, can be replayed up to its last complete frame.
+	FRecordingHeader Header;
+	Header.Magic = RecordingMagic;
+	Header.Version = RecordingVersion;
+	Header.FrameSize = static_cast<uint32>(RecordedFrameSize);
+	*Writer << Header;
+
+	return true;
+}
+
+void FUxtHandTrackingRecorder::Close()
+{
+	if (Writer)
+	{
+		Writer->Close();
+		Writer.Reset();
+	}
+
+	NumFrames = 0;
+}
+
+bool FUxtHandTrackingRecorder::IsOpen() const
+{
+	return Writer.IsValid();
+}
+
+int32 FUxtHandTrackingRecorder::GetNumFrames() const
+{
+	return NumFrames;
+}
+
+void FUxtHandTrackingRecorder::RecordFrame(const IUxtHandTracker& HandTracker, const FTransform& HeadPose, double Time)
+{
+	if (!Writer)
+	{
+		return;
+	}
+
+	// Zero unused fields so that identical input produces identical files
+	FRecordedFrame Frame;
+	FMemory::Memzero(Frame);
+
+	Frame.Time = Time;
+	Frame.HeadOrientation = HeadPose.GetRotation();
+	Frame.HeadPosition = HeadPose.GetLocation();
+
+	for (int32 HandIndex = 0; HandIndex < 2; ++HandIndex)
+	{
+		const EControllerHand Hand = GetHand(HandIndex);
+		const FUxtHandSnapshot& Snapshot = HandTracker.GetHandSnapshot(Hand);
+		FRecordedHand& RecordedHand = Frame.Hands[HandIndex];
+
+		RecordedHand.TrackingStatus = static_cast<uint8>(Snapshot.TrackingStatus);
+
+		if (HandTracker.IsHandController(Hand))
+		{
+			RecordedHand.Flags |= ERecordedHandFlags::IsHandController;
+		}
+
+		if (Snapshot.bHasJoints)
+		{
+			RecordedHand.Flags |= ERecordedHandFlags::HasJoints;
+			FMemory::Memcpy(RecordedHand.JointOrientations, Snapshot.JointOrientations, sizeof(RecordedHand.JointOrientations));
+			FMemory::Memcpy(RecordedHand.JointPositions, Snapshot.JointPositions, sizeof(RecordedHand.JointPositions));
+			FMemory::Memcpy(RecordedHand.JointRadii, Snapshot.JointRadii, sizeof(RecordedHand.JointRadii));
+		}
+
+		if (Snapshot.bHasPointerPose)
+		{
+			RecordedHand.Flags |= ERecordedHandFlags::HasPointerPose;
+			RecordedHand.PointerOrientation = Snapshot.PointerOrientation;
+			RecordedHand.PointerPosition = Snapshot.PointerPosition;
+		}
+
+		if (Snapshot.bHasGripPose)
+		{
+			RecordedHand.Flags |= ERecordedHandFlags::HasGripPose;
+			RecordedHand.GripOrientation = Snapshot.GripOrientation;
+			RecordedHand.GripPosition = Snapshot.GripPosition;
+		}
+
+		bool bIsGrabbing;
+		if (HandTracker.GetIsGrabbing(Hand, bIsGrabbing))
+		{
+			RecordedHand.Flags |= ERecordedHandFlags::HasGrabState | (bIsGrabbing ? ERecordedHandFlags::IsGrabbing : 0);
+		}
+
+		bool bIsSelectPressed;
+		if (HandTracker.GetIsSelectPressed(Hand, bIsSelectPressed))
+		{
+			RecordedHand.Flags |= ERecordedHandFlags::HasSelectState | (bIsSelectPressed ? ERecordedHandFlags::IsSelectPressed : 0);
+		}
+	}
+
+	const int64 FrameStart = Writer->Tell();
+	*Writer << Frame;
+	check(Writer->Tell() - FrameStart == RecordedFrameSize);
+
+	++NumFrames;
+}
+
+FUxtHandTrackingPlayer::~FUxtHandTrackingPlayer()
+{
+	Close();
+}
+
+bool FUxtHandTrackingPlayer::Open(const FString& Filename)
+{
+	Close();
+
+	const uint8* Data = nullptr;
+	int64 DataSize = 0;
+
+	MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+	if (MappedFile)
+	{
+		MappedRegion.Reset(MappedFile->MapRegion());
+	}
+
+	if (MappedRegion)
+	{
+		Data = MappedRegion->GetMappedPtr();
+		DataSize = MappedRegion->GetMappedSize();
+	}
+	else
+	{
+		MappedFile.Reset();
+		if (!FFileHelper::LoadFileToArray(FileData, *Filename, FILEREAD_Silent))
+		{
+			UE_LOG(UXTools, Warning, TEXT("Could not open hand tracking recording '%s'."), *Filename);
+			return false;
+		}
+
+		Data = FileData.GetData();
+		DataSize = FileData.Num();
+	}
+
+	FRecordingHeader Header;
+	if (DataSize >= RecordingHeaderSize)
+	{
+		FBufferReader Reader(const_cast<uint8*>(Data), RecordingHeaderSize, false);
+		Reader.SetByteSwapping(bRecordingByteSwapping);
+		Reader << Header;
+	}
+
+	if (Header.Magic != RecordingMagic || Header.Version != RecordingVersion || Header.FrameSize != RecordedFrameSize)
+	{
+		UE_LOG(UXTools, Warning, TEXT("'%s' is not a valid hand tracking recording."), *Filename);
+		Close();
+		return false;
+	}
+
+	// An incomplete last frame is left over if the recording was not closed
+	FrameData = Data + RecordingHeaderSize;
+	NumFrames = static_cast<int32>((DataSize - RecordingHeaderSize) / RecordedFrameSize);
+
+	SetFrameIndex(0);
+	return true;
+}
+
+void FUxtHandTrackingPlayer::Close()
+{
+	// The region must be released before the file it maps
+	MappedRegion.Reset();
+	MappedFile.Reset();
+	FileData.Empty();
+
+	FrameData = nullptr;
+	NumFrames = 0;
+
+	ClearFrame();
+}
+
+bool FUxtHandTrackingPlayer::IsOpen() const
+{
+	return FrameData != nullptr;
+}
+
+int32 FUxtHandTrackingPlayer::GetNumFrames() const
+{
+	return NumFrames;
+}
+
+int32 FUxtHandTrackingPlayer::GetFrameIndex() const
+{
+	return FrameIndex;
+}
+
+bool FUxtHandTrackingPlayer::SetFrameIndex(int32 NewFrameIndex)
+{
+	if (!IsOpen() || NewFrameIndex < 0 || NewFrameIndex >= NumFrames)
+	{
+		return false;
+	}
+
+	FRecordedFrame Frame;
+	ReadRecordedFrame(FrameData, NewFrameIndex, Frame);
+
+	FrameIndex = NewFrameIndex;
+	FrameTime = Frame.Time;
+	HeadPose = FTransform(Frame.HeadOrientation, Frame.HeadPosition);
+
+	for (int32 HandIndex = 0; HandIndex < 2; ++HandIndex)
+	{
+		const FRecordedHand& RecordedHand = Frame.Hands[HandIndex];
+		FUxtHandSnapshot& Snapshot = Snapshots[HandIndex];
+		FHandInputState& InputState = InputStates[HandIndex];
+
+		Snapshot.FrameId = GFrameCounter;
+		Snapshot.TrackingStatus = static_cast<ETrackingStatus>(RecordedHand.TrackingStatus);
+		Snapshot.bHasJoints = (RecordedHand.Flags & ERecordedHandFlags::HasJoints) != 0;
+		Snapshot.bHasPointerPose = (RecordedHand.Flags & ERecordedHandFlags::HasPointerPose) != 0;
+		Snapshot.bHasGripPose = (RecordedHand.Flags & ERecordedHandFlags::HasGripPose) != 0;
+
+		FMemory::Memcpy(Snapshot.JointOrientations, RecordedHand.JointOrientations, sizeof(Snapshot.JointOrientations));
+		FMemory::Memcpy(Snapshot.JointPositions, RecordedHand.JointPositions, sizeof(Snapshot.JointPositions));
+		FMemory::Memcpy(Snapshot.JointRadii, RecordedHand.JointRadii, sizeof(Snapshot.JointRadii));
+
+		Snapshot.PointerOrientation = RecordedHand.PointerOrientation;
+		Snapshot.PointerPosition = RecordedHand.PointerPosition;
+		Snapshot.GripOrientation = RecordedHand.GripOrientation;
+		Snapshot.GripPosition = RecordedHand.GripPosition;
+
+		InputState.bIsHandController = (RecordedHand.Flags & ERecordedHandFlags::IsHandController) != 0;
+		InputState.bHasGrabState = (RecordedHand.Flags & ERecordedHandFlags::HasGrabState) != 0;
+		InputState.bIsGrabbing = (RecordedHand.Flags & ERecordedHandFlags::IsGrabbing) != 0;
+		InputState.bHasSelectState = (RecordedHand.Flags & ERecordedHandFlags::HasSelectState) != 0;
+		InputState.bIsSelectPressed = (RecordedHand.Flags & ERecordedHandFlags::IsSelectPressed) != 0;
+	}
+
+	return true;
+}
+
+double FUxtHandTrackingPlayer::GetFrameTime() const
+{
+	return FrameTime;
+}
+
+double FUxtHandTrackingPlayer::GetFrameDeltaTime(int32 InFrameIndex) const
+{
+	if (!IsOpen() || NumFrames < 2 || InFrameIndex < 0 || InFrameIndex >= NumFrames)
+	{
+		return 0.0;
+	}
+
+	// The first frame has no predecessor, assume it took as long as the second
+	const int32 Index = FMath::Max(InFrameIndex, 1);
+	return ReadRecordedFrameTime(FrameData, Index) - ReadRecordedFrameTime(FrameData, Index - 1);
+}
+
+const FTransform& FUxtHandTrackingPlayer::GetHeadPose() const
+{
+	return HeadPose;
+}
+
+ETrackingStatus FUxtHandTrackingPlayer::GetTrackingStatus(EControllerHand Hand) const
+{
+	return Snapshots[GetHandIndex(Hand)].TrackingStatus;
+}
+
+bool FUxtHandTrackingPlayer::IsHandController(EControllerHand Hand) const
+{
+	return InputStates[GetHandIndex(Hand)].bIsHandController;
+}
+
+bool FUxtHandTrackingPlayer::GetJointState(
+	EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const
+{
+	return Snapshots[GetHandIndex(Hand)].GetJointState(Joint, OutOrientation, OutPosition, OutRadius);
+}
+
+bool FUxtHandTrackingPlayer::GetPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	return Snapshots[GetHandIndex(Hand)].GetPointerPose(OutOrientation, OutPosition);
+}
+
+bool FUxtHandTrackingPlayer::GetPredictedPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	// Predictions are not recorded, use the recorded pointer pose so that replays are deterministic
+	return Snapshots[GetHandIndex(Hand)].GetPointerPose(OutOrientation, OutPosition);
+}
+
+bool FUxtHandTrackingPlayer::GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	return Snapshots[GetHandIndex(Hand)].GetGripPose(OutOrientation, OutPosition);
+}
+
+bool FUxtHandTrackingPlayer::GetIsGrabbing(EControllerHand Hand, bool& OutIsGrabbing) const
+{
+	const FHandInputState& InputState = InputStates[GetHandIndex(Hand)];
+	if (InputState.bHasGrabState)
+	{
+		OutIsGrabbing = InputState.bIsGrabbing;
+		return true;
+	}
+	return false;
+}
+
+bool FUxtHandTrackingPlayer::GetIsSelectPressed(EControllerHand Hand, bool& OutIsSelectPressed) const
+{
+	const FHandInputState& InputState = InputStates[GetHandIndex(Hand)];
+	if (InputState.bHasSelectState)
+	{
+		OutIsSelectPressed = InputState.bIsSelectPressed;
+		return true;
+	}
+	return false;
+}
+
+const FUxtHandSnapshot& FUxtHandTrackingPlayer::GetHandSnapshot(EControllerHand Hand) const
+{
+	return Snapshots[GetHandIndex(Hand)];
+}
+
+void FUxtHandTrackingPlayer::ClearFrame()
+{
+	FrameIndex = INDEX_NONE;
+	FrameTime = 0.0;
+	HeadPose = FTransform::Identity;
+
+	for (int32 HandIndex = 0; HandIndex < 2; ++HandIndex)
+	{
+		Snapshots[HandIndex].TrackingStatus = ETrackingStatus::NotTracked;
+		Snapshots[HandIndex].bHasJoints = false;
+		Snapshots[HandIndex].bHasPointerPose = false;
+		Snapshots[HandIndex].bHasGripPose = false;
+		InputStates[HandIndex] = FHandInputState();
+	}
+}
@@ -0,0 +1,166 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HandTracking/UxtHandTrackingRecordingSubsystem.h"
+
+#include "Engine/World.h"
+#include "Misc/App.h"
+#include "Utils/UxtFunctionLibrary.h"
+#include "Utils/UxtHeadPoseSubsystem.h"
+
+namespace
+{
+	UUxtHeadPoseSubsystem* GetHeadPoseSubsystem(UWorld* World)
+	{
+		return World ? World->GetSubsystem<UUxtHeadPoseSubsystem>() : nullptr;
+	}
+} // namespace
+
+void UUxtHandTrackingRecordingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	TickStartDelegateHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &UUxtHandTrackingRecordingSubsystem::OnWorldTickStart);
+	PostActorTickDelegateHandle =
+		FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UUxtHandTrackingRecordingSubsystem::OnWorldPostActorTick);
+}
+
+void UUxtHandTrackingRecordingSubsystem::Deinitialize()
+{
+	StopRecording();
+	StopPlayback();
+
+	FWorldDelegates::OnWorldTickStart.Remove(TickStartDelegateHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickDelegateHandle);
+	TickStartDelegateHandle.Reset();
+	PostActorTickDelegateHandle.Reset();
+}
+
+bool UUxtHandTrackingRecordingSubsystem::StartRecording(const FString& Filename)
+{
+	if (!Recorder.Open(Filename))
+	{
+		return false;
+	}
+
+	RecordingStartTime = FApp::GetCurrentTime();
+	return true;
+}
+
+void UUxtHandTrackingRecordingSubsystem::StopRecording()
+{
+	Recorder.Close();
+}
+
+bool UUxtHandTrackingRecordingSubsystem::IsRecording() const
+{
+	return Recorder.IsOpen();
+}
+
+bool UUxtHandTrackingRecordingSubsystem::StartPlayback(const FString& Filename, bool bLoop)
+{
+	StopPlayback();
+
+	if (!Player.Open(Filename))
+	{
+		return false;
+	}
+
+	// Shadow the registered hand tracker, which keeps being updated and is used again when playback stops
+	PreviousOverrideHandTracker = IUxtHandTracker::GetOverride();
+	IUxtHandTracker::SetOverride(&Player);
+
+	// Tick with the recorded frame times, so that time dependent interactions replay exactly
+	bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+	PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+	FApp::SetUseFixedTimeStep(true);
+
+	bLoopPlayback = bLoop;
+	PlaybackFrameId = GFrameCounter;
+	ApplyPlaybackHeadPose();
+	UpdatePlaybackDeltaTime();
+	return true;
+}
+
+void UUxtHandTrackingRecordingSubsystem::StopPlayback()
+{
+	if (!Player.IsOpen())
+	{
+		return;
+	}
+
+	Player.Close();
+
+	if (IUxtHandTracker::GetOverride() == &Player)
+	{
+		IUxtHandTracker::SetOverride(PreviousOverrideHandTracker);
+	}
+	PreviousOverrideHandTracker = nullptr;
+
+	FApp::SetUseFixedTimeStep(bPreviousUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(PreviousFixedDeltaTime);
+
+	if (UUxtHeadPoseSubsystem* HeadPoseSubsystem = GetHeadPoseSubsystem(GetWorld()))
+	{
+		HeadPoseSubsystem->ClearHeadPoseOverride();
+	}
+}
+
+bool UUxtHandTrackingRecordingSubsystem::IsPlaying() const
+{
+	return Player.IsOpen();
+}
+
+int32 UUxtHandTrackingRecordingSubsystem::GetPlaybackFrameIndex() const
+{
+	return Player.GetFrameIndex();
+}
+
+void UUxtHandTrackingRecordingSubsystem::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaTime)
+{
+	if (World != GetWorld() || !Player.IsOpen() || PlaybackFrameId == GFrameCounter)
+	{
+		return;
+	}
+
+	PlaybackFrameId = GFrameCounter;
+
+	const int32 NextFrameIndex = Player.GetFrameIndex() + 1;
+	if (Player.SetFrameIndex(NextFrameIndex) || (bLoopPlayback && Player.SetFrameIndex(0)))
+	{
+		ApplyPlaybackHeadPose();
+		UpdatePlaybackDeltaTime();
+	}
+	else
+	{
+		StopPlayback();
+	}
+}
+
+void UUxtHandTrackingRecordingSubsystem::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaTime)
+{
+	if (World != GetWorld() || !Recorder.IsOpen())
+	{
+		return;
+	}
+
+	const FTransform HeadPose = UUxtFunctionLibrary::GetHeadPose(World);
+	Recorder.RecordFrame(IUxtHandTracker::Get(), HeadPose, FApp::GetCurrentTime() - RecordingStartTime);
+}
+
+void UUxtHandTrackingRecordingSubsystem::ApplyPlaybackHeadPose()
+{
+	if (UUxtHeadPoseSubsystem* HeadPoseSubsystem = GetHeadPoseSubsystem(GetWorld()))
+	{
+		HeadPoseSubsystem->SetHeadPoseOverride(Player.GetHeadPose());
+	}
+}
+
+void UUxtHandTrackingRecordingSubsystem::UpdatePlaybackDeltaTime()
+{
+	// The engine has already advanced time for this frame, the fixed delta time applies from the next frame on
+	const int32 NextFrameIndex = Player.GetFrameIndex() + 1;
+	const double DeltaTime = Player.GetFrameDeltaTime(NextFrameIndex < Player.GetNumFrames() ? NextFrameIndex : 0);
+	if (DeltaTime > 0.0)
+	{
+		FApp::SetFixedDeltaTime(DeltaTime);
+	}
+}
@@ -10,7 +10,6 @@
 #include "Engine/World.h"
 #include "HandTracking/IUxtHandTracker.h"
 #include "Input/UxtInputSubsystem.h"
-#include "Interactions/UxtFarTarget.h"
 #include "Interactions/UxtInteractionUtils.h"
 #include "Materials/MaterialParameterCollectionInstance.h"
 #include "UObject/ConstructorHelpers.h"
@@ -43,11 +42,27 @@ void UUxtFarPointerComponent::TickComponent(float DeltaTime, ELevelTick TickType
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	// Obtain new pointer origin and orientation
-	FQuat NewOrientation;
-	FVector NewOrigin;
+	FQuat NewOrientation = FQuat::Identity;
+	FVector NewOrigin = FVector::ZeroVector;
 	const bool bIsTracked = IUxtHandTracker::Get().GetPointerPose(Hand, NewOrientation, NewOrigin);
+	const FQuat RawOrientation = NewOrientation;
+	const FVector RawOrigin = NewOrigin;
+	if (bIsTracked && bFilterPointerPose)
+	{
+		NewOrigin = PointerOriginFilter.Filter(NewOrigin, DeltaTime, PointerOriginFilterSettings);
+		NewOrientation = PointerOrientationFilter.Filter(NewOrientation, DeltaTime, PointerOrientationFilterSettings);
+	}
+	else
+	{
+		// Restart filtering from the raw pose when tracking resumes
+		PointerOriginFilter.Reset();
+		PointerOrientationFilter.Reset();
+	}
+
 	if (bIsTracked)
 	{
+		UpdatePredictedPointerPose(RawOrientation, RawOrigin, NewOrientation, NewOrigin);
+		UpdatePointerVelocity(NewOrientation, NewOrigin, DeltaTime);
 		OnPointerPoseUpdated(NewOrientation, NewOrigin);
 		UpdateParameterCollection(GetHitPoint());
 
@@ -91,23 +106,6 @@ FTransform UUxtFarPointerComponent::GetCursorTransform() const
 	return Transform;
 }
 
-// Finds the far target a primitive belongs to, if any
-static UObject* FindFarTarget(UPrimitiveComponent* Primitive)
-{
-	if (Primitive && Primitive->GetOwner())
-	{
-		for (UActorComponent* Component : Primitive->GetOwner()->GetComponents())
-		{
-			if (Component->Implements<UUxtFarTarget>() && IUxtFarTarget::Execute_IsFarFocusable(Component, Primitive))
-			{
-				return Component;
-			}
-		}
-	}
-
-	return nullptr;
-}
-
 void UUxtFarPointerComponent::OnPointerPoseUpdated(const FQuat& NewOrientation, const FVector& NewOrigin)
 {
 	PointerOrientation = NewOrientation;
@@ -144,7 +142,18 @@ void UUxtFarPointerComponent::OnPointerPoseUpdated(const FQuat& NewOrientation,
 
 		// Query for simple collision volumes
 		FCollisionQueryParams QueryParams(NAME_None, false);
-		GetWorld()->LineTraceSingleByChannel(Hit, Start, End, TraceChannel, QueryParams);
+		if (bAsyncTrace)
+		{
+			const FTransform QueuePose = GetAsyncTracePose();
+			const FVector QueueForward = QueuePose.GetRotation().GetForwardVector();
+			const FVector QueueStart = QueuePose.GetLocation() + QueueForward * RayStartOffset;
+			const FVector QueueEnd = QueueStart + QueueForward * RayLength;
+			PointerTrace.TraceAsync(GetWorld(), Hit, Start, End, QueueStart, QueueEnd, TraceChannel, QueryParams);
+		}
+		else
+		{
+			PointerTrace.Trace(GetWorld(), Hit, Start, End, TraceChannel, QueryParams);
+		}
 
 		NewPrimitive = Hit.GetComponent();
 
@@ -161,7 +170,7 @@ void UUxtFarPointerComponent::OnPointerPoseUpdated(const FQuat& NewOrientation,
 
 			// Update hit primitive and far target
 			HitPrimitiveWeak = NewPrimitive;
-			FarTargetWeak = FindFarTarget(NewPrimitive);
+			FarTargetWeak = NewPrimitive ? UUxtInputSubsystem::GetFarTarget(NewPrimitive) : nullptr;
 		}
 
 		// Update cached hit info
@@ -205,6 +214,51 @@ void UUxtFarPointerComponent::OnPointerPoseUpdated(const FQuat& NewOrientation,
 #endif // ENABLE_VISUAL_LOG
 }
 
+void UUxtFarPointerComponent::UpdatePredictedPointerPose(
+	const FQuat& RawOrientation, const FVector& RawOrigin, const FQuat& NewOrientation, const FVector& NewOrigin)
+{
+	PredictedPointerOrigin = NewOrigin;
+	PredictedPointerOrientation = NewOrientation;
+
+	// Apply the predicted change to the filtered pose, so visuals are as steady as the ray used for interaction
+	FQuat PredictedOrientation;
+	FVector PredictedOrigin;
+	if (IUxtHandTracker::Get().GetPredictedPointerPose(Hand, PredictedOrientation, PredictedOrigin))
+	{
+		PredictedPointerOrigin += PredictedOrigin - RawOrigin;
+		PredictedPointerOrientation = PredictedOrientation * RawOrientation.Inverse() * NewOrientation;
+		PredictedPointerOrientation.Normalize();
+	}
+}
+
+void UUxtFarPointerComponent::UpdatePointerVelocity(const FQuat& NewOrientation, const FVector& NewOrigin, float DeltaTime)
+{
+	// The current pose is only a valid previous sample if the pointer was tracked in the last tick as well
+	const bool bHasValidPreviousSample = bHasPreviousSample;
+	bHasPreviousSample = true;
+
+	// Velocities are only needed to extrapolate async traces and are not valid until the pointer has been tracked for two ticks
+	if (!bAsyncTrace || !bCompensateTraceLatency || !bHasValidPreviousSample || DeltaTime <= KINDA_SMALL_NUMBER)
+	{
+		PointerLinearVelocity = FVector::ZeroVector;
+		PointerAngularVelocity = FVector::ZeroVector;
+		AsyncTraceLatency = 0.0f;
+		return;
+	}
+
+	PointerLinearVelocity = (NewOrigin - PointerOrigin) / DeltaTime;
+
+	FQuat DeltaRotation = NewOrientation * PointerOrientation.Inverse();
+	DeltaRotation.EnforceShortestArcWith(FQuat::Identity);
+	FVector Axis;
+	float Angle;
+	DeltaRotation.ToAxisAndAngle(Axis, Angle);
+	PointerAngularVelocity = Axis * (Angle / DeltaTime);
+
+	// Assume the next frame takes as long as this one
+	AsyncTraceLatency = DeltaTime;
+}
+
 void UUxtFarPointerComponent::SetPressed(bool bNewPressed)
 {
 	if (bPressed != bNewPressed)
@@ -236,6 +290,9 @@ void UUxtFarPointerComponent::SetEnabled(bool bNewEnabled)
 		}
 		else
 		{
+			// Poses from before the pointer was disabled must not be used to estimate velocities
+			bHasPreviousSample = false;
+
 			// Release pointer if it was pressed
 			SetPressed(false);
 
@@ -270,6 +327,50 @@ FVector UUxtFarPointerComponent::GetRayStart() const
 	return PointerOrigin + PointerOrientation.GetForwardVector() * RayStartOffset;
 }
 
+FVector UUxtFarPointerComponent::GetPredictedPointerOrigin() const
+{
+	return PredictedPointerOrigin;
+}
+
+FQuat UUxtFarPointerComponent::GetPredictedPointerOrientation() const
+{
+	return PredictedPointerOrientation;
+}
+
+FVector UUxtFarPointerComponent::GetPredictedRayStart() const
+{
+	return PredictedPointerOrigin + PredictedPointerOrientation.GetForwardVector() * RayStartOffset;
+}
+
+FVector UUxtFarPointerComponent::GetPredictedHitPoint() const
+{
+	// Intersect the predicted ray with the plane of the hit surface, keeping the hit point if the ray doesn't reach it
+	const FVector Forward = PredictedPointerOrientation.GetForwardVector();
+	const float ForwardDotNormal = FVector::DotProduct(Forward, HitNormal);
+	if (FMath::Abs(ForwardDotNormal) <= KINDA_SMALL_NUMBER)
+	{
+		return HitPoint;
+	}
+
+	const FVector Start = GetPredictedRayStart();
+	const float Distance = FVector::DotProduct(HitPoint - Start, HitNormal) / ForwardDotNormal;
+	return Distance > 0.0f ? Start + Forward * Distance : HitPoint;
+}
+
+FTransform UUxtFarPointerComponent::GetAsyncTracePose() const
+{
+	if (!bCompensateTraceLatency)
+	{
+		return FTransform(PointerOrientation, PointerOrigin);
+	}
+
+	const float AngularSpeed = PointerAngularVelocity.Size();
+	const FQuat Rotation = AngularSpeed > KINDA_SMALL_NUMBER
+							   ? FQuat(PointerAngularVelocity / AngularSpeed, AngularSpeed * AsyncTraceLatency) * PointerOrientation
+							   : PointerOrientation;
+	return FTransform(Rotation, PointerOrigin + PointerLinearVelocity * AsyncTraceLatency);
+}
+
 UPrimitiveComponent* UUxtFarPointerComponent::GetHitPrimitive() const
 {
 	return HitPrimitiveWeak.Get();
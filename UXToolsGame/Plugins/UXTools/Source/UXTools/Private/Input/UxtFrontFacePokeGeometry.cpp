@@ -0,0 +1,43 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Input/UxtFrontFacePokeGeometry.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "PhysicsEngine/BodySetup.h"
+
+bool FUxtFrontFacePokeGeometry::Update(UPrimitiveComponent* Primitive)
+{
+	const FTransform& NewTransform = Primitive->GetComponentTransform();
+	const UBodySetup* NewBodySetup = Primitive->GetBodySetup();
+	const FBoxSphereBounds& NewBounds = Primitive->Bounds;
+
+	// Bounds are updated by the primitive whenever its shape changes, e.g. when changing the extents of a box component
+	if (PrimitiveWeak.Get() == Primitive && BodySetup == NewBodySetup && ComponentTransform.Equals(NewTransform, 0.0f) &&
+		Bounds.Origin == NewBounds.Origin && Bounds.BoxExtent == NewBounds.BoxExtent)
+	{
+		return false;
+	}
+
+	PrimitiveWeak = Primitive;
+	BodySetup = NewBodySetup;
+	ComponentTransform = NewTransform;
+	Bounds = NewBounds;
+
+	bIsBoxShape = false;
+	if (BodySetup)
+	{
+		const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+		const int32 ElementCount = AggGeom.GetElementCount();
+		bIsBoxShape = (ElementCount != 0 && ElementCount == AggGeom.BoxElems.Num());
+	}
+
+	const FMatrix TransformMatrix = NewTransform.ToMatrixWithScale();
+	LocalExtent = Primitive->CalcLocalBounds().BoxExtent;
+	ScaledExtent = LocalExtent * NewTransform.GetScale3D();
+	ScaleX = TransformMatrix.GetScaleVector().X;
+	InverseTransform = TransformMatrix.InverseFast();
+	InverseTransformNoScale = NewTransform.ToMatrixNoScale().InverseFast();
+
+	return true;
+}
@@ -164,24 +164,19 @@ bool AUxtHandInteractionActor::QueryProximityVolume(bool& OutHasNearTarget)
 {
 	OutHasNearTarget = false;
 
-	if (IUxtHandTracker::Get().GetTrackingStatus(Hand) == ETrackingStatus::NotTracked)
+	const FUxtHandSnapshot& HandSnapshot = IUxtHandTracker::Get().GetHandSnapshot(Hand);
+	if (HandSnapshot.TrackingStatus == ETrackingStatus::NotTracked)
 	{
 		return false;
 	}
 
 	// If controller is a hand we use the proximity detection volume,
 	// otherwise near interaction is disabled and only far interaction used.
-	if (IUxtHandTracker::Get().IsHandController(Hand))
+	if (HandSnapshot.bHasJoints)
 	{
-		FQuat IndexTipOrientation, PalmOrientation;
-		FVector IndexTipPosition, PalmPosition;
-		float IndexTipRadius, PalmRadius;
-		const bool bIsIndexTipValid =
-			IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::IndexTip, IndexTipOrientation, IndexTipPosition, IndexTipRadius);
-		const bool bIsPalmValid =
-			IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::Palm, PalmOrientation, PalmPosition, PalmRadius);
-		// We've checked for valid hand data above
-		check(bIsIndexTipValid && bIsPalmValid);
+		const FVector IndexTipPosition = HandSnapshot.JointPositions[(int32)EHandKeypoint::IndexTip];
+		const FQuat PalmOrientation = HandSnapshot.JointOrientations[(int32)EHandKeypoint::Palm];
+		const FVector PalmPosition = HandSnapshot.JointPositions[(int32)EHandKeypoint::Palm];
 
 		const FVector PalmForward = PalmOrientation.GetForwardVector();
 		const FVector PalmToIndex = IndexTipPosition - PalmPosition;
@@ -368,15 +363,13 @@ void AUxtHandInteractionActor::VLogHandJoints() const
 		return;
 	}
 
-	IUxtHandTracker& HandTracker = IUxtHandTracker::Get();
+	const FUxtHandSnapshot& HandSnapshot = IUxtHandTracker::Get().GetHandSnapshot(Hand);
 
 	// Hand label at the wrist position
 	{
-		FVector WristPosition;
-		FQuat WristOrientation;
-		float WristRadius;
-		if (HandTracker.GetJointState(Hand, EHandKeypoint::Wrist, WristOrientation, WristPosition, WristRadius))
+		if (HandSnapshot.bHasJoints)
 		{
+			const FVector WristPosition = HandSnapshot.JointPositions[(int32)EHandKeypoint::Wrist];
 			FString VLogHand = (Hand == EControllerHand::Left) ? TEXT("Left") : TEXT("Right");
 			UE_VLOG_LOCATION(this, LogUxtHandTracking, Log, WristPosition, 0.0f, VLogColorHandJoints, TEXT("%s Hand"), *VLogHand);
 		}
@@ -386,7 +379,7 @@ void AUxtHandInteractionActor::VLogHandJoints() const
 	{
 		FVector PointerOrigin;
 		FQuat PointerOrientation;
-		if (HandTracker.GetPointerPose(Hand, PointerOrientation, PointerOrigin))
+		if (HandSnapshot.GetPointerPose(PointerOrientation, PointerOrigin))
 		{
 			UE_VLOG_SEGMENT(
 				this, LogUxtHandTracking, Log, PointerOrigin, PointerOrigin + PointerOrientation.GetAxisX() * 15.0f, FColor::Red, TEXT(""));
@@ -399,13 +392,11 @@ void AUxtHandInteractionActor::VLogHandJoints() const
 	};
 
 	// Utility function for drawing a bone segment
-	auto VlogJointSegment = [this, &HandTracker](EHandKeypoint JointA, EHandKeypoint JointB) {
-		FVector PositionA, PositionB;
-		FQuat OrientationA, OrientationB;
-		float RadiusA, RadiusB;
-		if (HandTracker.GetJointState(Hand, JointA, OrientationA, PositionA, RadiusA) &&
-			HandTracker.GetJointState(Hand, JointB, OrientationB, PositionB, RadiusB))
+	auto VlogJointSegment = [this, &HandSnapshot](EHandKeypoint JointA, EHandKeypoint JointB) {
+		if (HandSnapshot.bHasJoints)
 		{
+			const FVector PositionA = HandSnapshot.JointPositions[(int32)JointA];
+			const FVector PositionB = HandSnapshot.JointPositions[(int32)JointB];
 			UE_VLOG_SEGMENT_THICK(this, LogUxtHandTracking, Log, PositionA, PositionB, VLogColorHandJoints, 5.0f, TEXT(""));
 		}
 	};
@@ -3,24 +3,37 @@
 
 #include "Input/UxtInputSubsystem.h"
 
+#include "Engine/GameInstance.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
 #include "Input/UxtFarPointerComponent.h"
 #include "Input/UxtNearPointerComponent.h"
 #include "Interactions/UxtFarHandler.h"
+#include "Interactions/UxtFarTarget.h"
 #include "Interactions/UxtGrabHandler.h"
 #include "Interactions/UxtPokeHandler.h"
 #include "Templates/SubclassOf.h"
+#include "UObject/UObjectGlobals.h"
 
 namespace
 {
-	UUxtInputSubsystem* GetInputSubsystem(UObject* WorldContextObject)
+	/** Returns null in worlds without a game instance, e.g. editor and preview worlds. */
+	UUxtInputSubsystem* GetInputSubsystem(const UObject* WorldContextObject)
 	{
-		return WorldContextObject->GetWorld()->GetGameInstance()->GetSubsystem<UUxtInputSubsystem>();
+		const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+		const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		return GameInstance ? GameInstance->GetSubsystem<UUxtInputSubsystem>() : nullptr;
 	}
 } // namespace
 
 bool UUxtInputSubsystem::RegisterHandler(UObject* Handler, TSubclassOf<UInterface> Interface)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Handler);
+	if (!InputSubsystem)
+	{
+		return false;
+	}
 
 	const UClass* Class = Handler->GetClass();
 	if (Class && Class->ImplementsInterface(Interface))
@@ -35,6 +48,10 @@ bool UUxtInputSubsystem::RegisterHandler(UObject* Handler, TSubclassOf<UInterfac
 bool UUxtInputSubsystem::UnregisterHandler(UObject* Handler, TSubclassOf<UInterface> Interface)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Handler);
+	if (!InputSubsystem)
+	{
+		return false;
+	}
 
 	const UClass* Class = Handler->GetClass();
 	if (Class && Class->ImplementsInterface(Interface))
@@ -55,130 +72,687 @@ bool UUxtInputSubsystem::UnregisterHandler(UObject* Handler, TSubclassOf<UInterf
 	return false;
 }
 
+void FUxtInputEventQueueTickFunction::ExecuteTick(
+	float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem)
+	{
+		Subsystem->FlushEventQueue();
+	}
+}
+
+FString FUxtInputEventQueueTickFunction::DiagnosticMessage()
+{
+	return TEXT("FUxtInputEventQueueTickFunction");
+}
+
+void UUxtInputSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	EventQueueTickFunction.Subsystem = this;
+	EventQueueTickFunction.bCanEverTick = true;
+	EventQueueTickFunction.bStartWithTickEnabled = true;
+	EventQueueTickFunction.TickGroup = TG_PostPhysics;
+
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UUxtInputSubsystem::OnWorldCleanup);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UUxtInputSubsystem::OnPostGarbageCollect);
+}
+
+void UUxtInputSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	WorldCleanupHandle.Reset();
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	PostGarbageCollectHandle.Reset();
+
+	EventQueueTickFunction.UnRegisterTickFunction();
+	EventQueue.Empty();
+
+	InterfaceComponentCache.Empty();
+	FarTargetCache.Empty();
+
+	Super::Deinitialize();
+}
+
+void UUxtInputSubsystem::SetEventQueueEnabled(UObject* WorldContextObject, bool bEnabled, TEnumAsByte<ETickingGroup> FlushTickGroup)
+{
+	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(WorldContextObject);
+	if (!InputSubsystem)
+	{
+		return;
+	}
+
+	if (bEnabled)
+	{
+		InputSubsystem->EventQueueTickFunction.UnRegisterTickFunction();
+		InputSubsystem->EventQueueTickFunction.TickGroup = FlushTickGroup;
+		InputSubsystem->RegisterEventQueueTickFunction(WorldContextObject->GetWorld());
+		InputSubsystem->bEventQueueEnabled = true;
+	}
+	else if (InputSubsystem->bEventQueueEnabled)
+	{
+		InputSubsystem->bEventQueueEnabled = false;
+		InputSubsystem->FlushEventQueue();
+		InputSubsystem->EventQueueTickFunction.UnRegisterTickFunction();
+	}
+}
+
+bool UUxtInputSubsystem::IsEventQueueEnabled(UObject* WorldContextObject)
+{
+	const UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(WorldContextObject);
+	return InputSubsystem && InputSubsystem->bEventQueueEnabled;
+}
+
+void UUxtInputSubsystem::FlushEventQueue()
+{
+	if (bIsFlushingEvents)
+	{
+		return;
+	}
+
+	// Events raised by handlers during the flush are dispatched immediately
+	bIsFlushingEvents = true;
+	Swap(EventQueue, FlushingEvents);
+
+	for (FlushingEventIndex = 0; FlushingEventIndex < FlushingEvents.Num(); ++FlushingEventIndex)
+	{
+		DispatchQueuedEvent(FlushingEvents[FlushingEventIndex]);
+	}
+
+	FlushingEvents.Reset();
+	FlushingEventIndex = 0;
+	bIsFlushingEvents = false;
+}
+
+void UUxtInputSubsystem::FlushPointerEvents(UUxtPointerComponent* Pointer)
+{
+	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
+	if (!InputSubsystem)
+	{
+		return;
+	}
+
+	TArray<FUxtQueuedInputEvent, TInlineAllocator<8>> PointerEvents;
+
+	// If the pointer is destroyed by a handler during a flush, its remaining events in the flush come first.
+	// They are cleared rather than removed to keep the flush index valid.
+	if (InputSubsystem->bIsFlushingEvents)
+	{
+		TArray<FUxtQueuedInputEvent>& FlushingEvents = InputSubsystem->FlushingEvents;
+		for (int32 Index = InputSubsystem->FlushingEventIndex + 1; Index < FlushingEvents.Num(); ++Index)
+		{
+			if (FlushingEvents[Index].Pointer == Pointer)
+			{
+				PointerEvents.Add(FlushingEvents[Index]);
+				FlushingEvents[Index].Pointer = nullptr;
+			}
+		}
+	}
+
+	InputSubsystem->EventQueue.RemoveAll([Pointer, &PointerEvents](const FUxtQueuedInputEvent& Event) {
+		if (Event.Pointer == Pointer)
+		{
+			PointerEvents.Add(Event);
+			return true;
+		}
+		return false;
+	});
+
+	if (PointerEvents.Num() == 0)
+	{
+		return;
+	}
+
+	// Events raised by handlers are dispatched immediately, as during a full flush
+	TGuardValue<bool> FlushingGuard(InputSubsystem->bIsFlushingEvents, true);
+	for (const FUxtQueuedInputEvent& Event : PointerEvents)
+	{
+		DispatchQueuedEvent(Event);
+	}
+}
+
+bool UUxtInputSubsystem::QueueEvent(EUxtInputEventType Type, UPrimitiveComponent* Target, UUxtPointerComponent* Pointer)
+{
+	if (!bEventQueueEnabled || bIsFlushingEvents)
+	{
+		return false;
+	}
+
+	// The tick function is unregistered when its world is cleaned up, e.g. on map change
+	if (!EventQueueTickFunction.IsTickFunctionRegistered())
+	{
+		RegisterEventQueueTickFunction(Pointer->GetWorld());
+	}
+
+	switch (Type)
+	{
+	case EUxtInputEventType::UpdatedFarFocus:
+	case EUxtInputEventType::FarDragged:
+	case EUxtInputEventType::UpdateGrabFocus:
+	case EUxtInputEventType::UpdateGrab:
+	case EUxtInputEventType::UpdatePokeFocus:
+	case EUxtInputEventType::UpdatePoke:
+		// Handlers read the current pointer state, so an update is redundant
+		// if the last queued event for the same target and pointer is the same update.
+		for (int32 Index = EventQueue.Num() - 1; Index >= 0; --Index)
+		{
+			const FUxtQueuedInputEvent& Event = EventQueue[Index];
+			if (Event.Target == Target && Event.Pointer == Pointer)
+			{
+				if (Event.Type == Type)
+				{
+					return true;
+				}
+				break;
+			}
+		}
+		break;
+	default:
+		break;
+	}
+
+	EventQueue.Add({Target, Pointer, Type});
+	return true;
+}
+
+void UUxtInputSubsystem::DispatchQueuedEvent(const FUxtQueuedInputEvent& Event)
+{
+	UPrimitiveComponent* Target = Event.Target.Get();
+	UUxtPointerComponent* Pointer = Event.Pointer.Get();
+
+	// Skip events of pointers or targets destroyed since the event was queued
+	if (!Pointer || (!Target && !Event.Target.IsExplicitlyNull()))
+	{
+		return;
+	}
+
+	switch (Event.Type)
+	{
+	case EUxtInputEventType::EnterFarFocus:
+		RaiseEnterFarFocus(Target, static_cast<UUxtFarPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::UpdatedFarFocus:
+		RaiseUpdatedFarFocus(Target, static_cast<UUxtFarPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::ExitFarFocus:
+		RaiseExitFarFocus(Target, static_cast<UUxtFarPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::FarPressed:
+		RaiseFarPressed(Target, static_cast<UUxtFarPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::FarDragged:
+		RaiseFarDragged(Target, static_cast<UUxtFarPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::FarReleased:
+		RaiseFarReleased(Target, static_cast<UUxtFarPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::EnterGrabFocus:
+		RaiseEnterGrabFocus(Target, static_cast<UUxtNearPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::UpdateGrabFocus:
+		RaiseUpdateGrabFocus(Target, static_cast<UUxtNearPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::ExitGrabFocus:
+		RaiseExitGrabFocus(Target, static_cast<UUxtNearPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::BeginGrab:
+		RaiseBeginGrab(Target, static_cast<UUxtNearPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::UpdateGrab:
+		RaiseUpdateGrab(Target, static_cast<UUxtNearPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::EndGrab:
+		RaiseEndGrab(Target, static_cast<UUxtNearPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::EnterPokeFocus:
+		RaiseEnterPokeFocus(Target, static_cast<UUxtNearPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::UpdatePokeFocus:
+		RaiseUpdatePokeFocus(Target, static_cast<UUxtNearPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::ExitPokeFocus:
+		RaiseExitPokeFocus(Target, static_cast<UUxtNearPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::BeginPoke:
+		RaiseBeginPoke(Target, static_cast<UUxtNearPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::UpdatePoke:
+		RaiseUpdatePoke(Target, static_cast<UUxtNearPointerComponent*>(Pointer));
+		break;
+	case EUxtInputEventType::EndPoke:
+		RaiseEndPoke(Target, static_cast<UUxtNearPointerComponent*>(Pointer));
+		break;
+	}
+}
+
+void UUxtInputSubsystem::RegisterEventQueueTickFunction(UWorld* World)
+{
+	if (World && World->PersistentLevel)
+	{
+		EventQueueTickFunction.RegisterTickFunction(World->PersistentLevel);
+		EventQueueWorld = World;
+	}
+}
+
+void UUxtInputSubsystem::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if (World == EventQueueWorld.Get())
+	{
+		EventQueue.Reset();
+		EventQueueTickFunction.UnRegisterTickFunction();
+		EventQueueWorld.Reset();
+	}
+}
+
+void UUxtInputSubsystem::OnPostGarbageCollect()
+{
+	// Weak keys of collected objects never match objects created later, so entries of live objects remain valid
+	PruneInterfaceComponentCache();
+	PruneFarTargetCache();
+}
+
+FUxtInterfaceComponentArray UUxtInputSubsystem::GetInterfaceComponents(AActor* Actor, TSubclassOf<UInterface> Interface)
+{
+	FUxtInterfaceComponentArray Components;
+	if (!Actor)
+	{
+		return Components;
+	}
+
+	if (UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Actor))
+	{
+		return InputSubsystem->FindOrAddInterfaceComponents(Actor, Interface).Components;
+	}
+
+	// Without a game instance there is no cache, collect the components on every call
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (Component && Component->GetClass()->ImplementsInterface(Interface))
+		{
+			Components.Add(Component);
+		}
+	}
+	return Components;
+}
+
+const FUxtInterfaceComponentCacheEntry& UUxtInputSubsystem::FindOrAddInterfaceComponents(AActor* Actor, UClass* Interface)
+{
+	const int32 NumComponents = Actor->GetComponents().Num();
+
+	FUxtActorInterfaceComponentCache* ActorEntries = InterfaceComponentCache.Find(Actor);
+	if (ActorEntries)
+	{
+		// Creating or destroying a component changes the size of the owner's component set, including components that do not
+		// notify the subsystem. Registration updates cover components that are re-registered or swapped within one frame.
+		if (ActorEntries->NumComponents != NumComponents)
+		{
+			ActorEntries->Entries.Reset();
+		}
+
+		for (const FUxtInterfaceComponentCacheEntry& Entry : ActorEntries->Entries)
+		{
+			if (Entry.Interface == Interface)
+			{
+				return Entry;
+			}
+		}
+	}
+	else
+	{
+		if (InterfaceComponentCache.Num() >= InterfaceComponentCachePruneSize)
+		{
+			PruneInterfaceComponentCache();
+		}
+		ActorEntries = &InterfaceComponentCache.Add(Actor);
+	}
+	ActorEntries->NumComponents = NumComponents;
+
+	// The owner's components are only walked when an interface is first queried or after its component set has changed.
+	// Destroyed components are skipped by the callers, they remain in the entry as invalid weak pointers.
+	FUxtInterfaceComponentCacheEntry& Entry = ActorEntries->Entries.AddDefaulted_GetRef();
+	Entry.Interface = Interface;
+	Entry.Revision = NextInterfaceComponentsRevision++;
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (Component && Component->GetClass()->ImplementsInterface(Interface))
+		{
+			Entry.Components.Add(Component);
+		}
+	}
+
+	return Entry;
+}
+
+void UUxtInputSubsystem::RegisterInterfaceComponent(UActorComponent* Component)
+{
+	if (UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Component))
+	{
+		InputSubsystem->UpdateInterfaceComponents(Component, true);
+	}
+}
+
+void UUxtInputSubsystem::UnregisterInterfaceComponent(UActorComponent* Component)
+{
+	if (UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Component))
+	{
+		InputSubsystem->UpdateInterfaceComponents(Component, false);
+	}
+}
+
+void UUxtInputSubsystem::UpdateInterfaceComponents(UActorComponent* Component, bool bRegistered)
+{
+	// Entries of actors that have not been queried yet are built from their component set on the first lookup
+	FUxtActorInterfaceComponentCache* ActorEntries = InterfaceComponentCache.Find(Component->GetOwner());
+	if (!ActorEntries)
+	{
+		return;
+	}
+
+	for (FUxtInterfaceComponentCacheEntry& Entry : ActorEntries->Entries)
+	{
+		if (Component->GetClass()->ImplementsInterface(Entry.Interface))
+		{
+			if (bRegistered)
+			{
+				Entry.Components.AddUnique(Component);
+			}
+			else
+			{
+				Entry.Components.Remove(Component);
+			}
+
+			// Far target entries built from the previous revision are rebuilt on their next lookup
+			Entry.Revision = NextInterfaceComponentsRevision++;
+		}
+	}
+}
+
+void UUxtInputSubsystem::PruneInterfaceComponentCache()
+{
+	for (auto It = InterfaceComponentCache.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// Far target entries only refer to valid components, so dropping destroyed ones does not change the entry revision
+		for (FUxtInterfaceComponentCacheEntry& Entry : It.Value().Entries)
+		{
+			Entry.Components.RemoveAll([](const TWeakObjectPtr<UActorComponent>& Component) { return !Component.IsValid(); });
+		}
+	}
+
+	InterfaceComponentCachePruneSize = FMath::Max(64, InterfaceComponentCache.Num() * 2);
+}
+
+UObject* UUxtInputSubsystem::GetFarTarget(UPrimitiveComponent* Primitive)
+{
+	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Primitive);
+	return InputSubsystem ? InputSubsystem->FindOrAddFarTarget(Primitive) : nullptr;
+}
+
+void UUxtInputSubsystem::InvalidateFarTargets(AActor* Actor)
+{
+	// Far targets may change state outside of a game world, where there is no cache to invalidate
+	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Actor);
+	if (!InputSubsystem)
+	{
+		return;
+	}
+
+	// Far target entries of the actor's primitives are only valid for the revision of the far target entry they were built from
+	if (FUxtActorInterfaceComponentCache* ActorEntries = InputSubsystem->InterfaceComponentCache.Find(Actor))
+	{
+		for (FUxtInterfaceComponentCacheEntry& Entry : ActorEntries->Entries)
+		{
+			if (Entry.Interface == UUxtFarTarget::StaticClass())
+			{
+				Entry.Revision = InputSubsystem->NextInterfaceComponentsRevision++;
+			}
+		}
+	}
+}
+
+UObject* UUxtInputSubsystem::FindOrAddFarTarget(UPrimitiveComponent* Primitive)
+{
+	AActor* Owner = Primitive->GetOwner();
+	if (!Owner)
+	{
+		return nullptr;
+	}
+
+	const FUxtInterfaceComponentCacheEntry& FarTargets = FindOrAddInterfaceComponents(Owner, UUxtFarTarget::StaticClass());
+	const uint32 FarTargetsRevision = FarTargets.Revision;
+
+	const TWeakObjectPtr<const UPrimitiveComponent> Key(Primitive);
+	if (const FUxtFarTargetCacheEntry* Entry = FarTargetCache.Find(Key))
+	{
+		// Far targets can only be added to the actor along with a new revision of its far target entry
+		if (Entry->FarTargetsRevision == FarTargetsRevision && (!Entry->bHasFarTarget || Entry->FarTarget.IsValid()))
+		{
+			return Entry->FarTarget.Get();
+		}
+	}
+	else if (FarTargetCache.Num() >= FarTargetCachePruneSize)
+	{
+		PruneFarTargetCache();
+	}
+
+	// Copy the far targets, components registered while querying them update the actor's entries
+	const FUxtInterfaceComponentArray Components = FarTargets.Components;
+
+	UObject* FarTarget = nullptr;
+	for (const TWeakObjectPtr<UActorComponent>& Component : Components)
+	{
+		if (Component.IsValid() && IUxtFarTarget::Execute_IsFarFocusable(Component.Get(), Primitive))
+		{
+			FarTarget = Component.Get();
+			break;
+		}
+	}
+
+	FUxtFarTargetCacheEntry& Entry = FarTargetCache.FindOrAdd(Key);
+	Entry.FarTarget = FarTarget;
+	Entry.FarTargetsRevision = FarTargetsRevision;
+	Entry.bHasFarTarget = FarTarget != nullptr;
+
+	return FarTarget;
+}
+
+void UUxtInputSubsystem::PruneFarTargetCache()
+{
+	for (auto It = FarTargetCache.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	FarTargetCachePruneSize = FMath::Max(64, FarTargetCache.Num() * 2);
+}
+
 void UUxtInputSubsystem::RaiseEnterFarFocus(UPrimitiveComponent* Target, UUxtFarPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtFarHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtFarHandler::Execute_OnEnterFarFocus(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::EnterFarFocus, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtFarHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtFarHandler::Execute_OnEnterFarFocus(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseUpdatedFarFocus(UPrimitiveComponent* Target, UUxtFarPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtFarHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtFarHandler::Execute_OnUpdatedFarFocus(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::UpdatedFarFocus, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtFarHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtFarHandler::Execute_OnUpdatedFarFocus(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseExitFarFocus(UPrimitiveComponent* Target, UUxtFarPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtFarHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtFarHandler::Execute_OnExitFarFocus(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::ExitFarFocus, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtFarHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtFarHandler::Execute_OnExitFarFocus(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseFarPressed(UPrimitiveComponent* Target, UUxtFarPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtFarHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtFarHandler::Execute_OnFarPressed(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::FarPressed, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtFarHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtFarHandler::Execute_OnFarPressed(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseFarDragged(UPrimitiveComponent* Target, UUxtFarPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtFarHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtFarHandler::Execute_OnFarDragged(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::FarDragged, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtFarHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtFarHandler::Execute_OnFarDragged(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseFarReleased(UPrimitiveComponent* Target, UUxtFarPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtFarHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtFarHandler::Execute_OnFarReleased(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::FarReleased, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtFarHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtFarHandler::Execute_OnFarReleased(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseEnterGrabFocus(UPrimitiveComponent* Target, UUxtNearPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtGrabHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtGrabHandler::Execute_OnEnterGrabFocus(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::EnterGrabFocus, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtGrabHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtGrabHandler::Execute_OnEnterGrabFocus(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseUpdateGrabFocus(UPrimitiveComponent* Target, UUxtNearPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtGrabHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtGrabHandler::Execute_OnUpdateGrabFocus(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::UpdateGrabFocus, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtGrabHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtGrabHandler::Execute_OnUpdateGrabFocus(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseExitGrabFocus(UPrimitiveComponent* Target, UUxtNearPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtGrabHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtGrabHandler::Execute_OnExitGrabFocus(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::ExitGrabFocus, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtGrabHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtGrabHandler::Execute_OnExitGrabFocus(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseBeginGrab(UPrimitiveComponent* Target, UUxtNearPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtGrabHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtGrabHandler::Execute_OnBeginGrab(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::BeginGrab, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtGrabHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtGrabHandler::Execute_OnBeginGrab(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseUpdateGrab(UPrimitiveComponent* Target, UUxtNearPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtGrabHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtGrabHandler::Execute_OnUpdateGrab(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::UpdateGrab, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtGrabHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtGrabHandler::Execute_OnUpdateGrab(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseEndGrab(UPrimitiveComponent* Target, UUxtNearPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtGrabHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtGrabHandler::Execute_OnEndGrab(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::EndGrab, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtGrabHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtGrabHandler::Execute_OnEndGrab(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseEnterPokeFocus(UPrimitiveComponent* Target, UUxtNearPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtPokeHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnEnterPokeFocus(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::EnterPokeFocus, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtPokeHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnEnterPokeFocus(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseUpdatePokeFocus(UPrimitiveComponent* Target, UUxtNearPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtPokeHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnUpdatePokeFocus(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::UpdatePokeFocus, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtPokeHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnUpdatePokeFocus(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseExitPokeFocus(UPrimitiveComponent* Target, UUxtNearPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtPokeHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnExitPokeFocus(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::ExitPokeFocus, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtPokeHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnExitPokeFocus(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseBeginPoke(UPrimitiveComponent* Target, UUxtNearPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtPokeHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnBeginPoke(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::BeginPoke, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtPokeHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnBeginPoke(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseUpdatePoke(UPrimitiveComponent* Target, UUxtNearPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtPokeHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnUpdatePoke(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::UpdatePoke, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtPokeHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnUpdatePoke(Handler, Pointer); });
+	}
 }
 
 void UUxtInputSubsystem::RaiseEndPoke(UPrimitiveComponent* Target, UUxtNearPointerComponent* Pointer)
 {
 	UUxtInputSubsystem* InputSubsystem = GetInputSubsystem(Pointer);
-	InputSubsystem->RaiseEvent<UUxtPokeHandler>(
-		Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnEndPoke(Handler, Pointer); });
+	if (InputSubsystem && !InputSubsystem->QueueEvent(EUxtInputEventType::EndPoke, Target, Pointer))
+	{
+		InputSubsystem->RaiseEvent<UUxtPokeHandler>(
+			Target, [&Pointer](UObject* Handler) { IUxtPokeHandler::Execute_OnEndPoke(Handler, Pointer); });
+	}
 }
 
 template <>
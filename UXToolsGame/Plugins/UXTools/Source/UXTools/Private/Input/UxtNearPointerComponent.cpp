@@ -15,7 +15,6 @@
 #include "Interactions/UxtPokeTarget.h"
 #include "Materials/MaterialParameterCollection.h"
 #include "Materials/MaterialParameterCollectionInstance.h"
-#include "PhysicsEngine/BodySetup.h"
 #include "UObject/ConstructorHelpers.h"
 #include "VisualLogger/VisualLogger.h"
 
@@ -24,20 +23,6 @@ DEFINE_LOG_CATEGORY_STATIC(LogUxtPokePointer, Log, All);
 
 namespace
 {
-	bool IsBoxShape(UPrimitiveComponent& Primitive)
-	{
-		if (UBodySetup* BodySetup = Primitive.GetBodySetup())
-		{
-			FKAggregateGeom AggGeom = BodySetup->AggGeom;
-			const int32 ElementCount = AggGeom.GetElementCount();
-			if (ElementCount != 0 && ElementCount == AggGeom.BoxElems.Num())
-			{
-				return true;
-			}
-		}
-		return false;
-	}
-
 	/**
 	 * Used for checking on which side of a front face pokable's front face the pointer
 	 * sphere is. This is important as BeginPoke can only be called if the pointer sphere
@@ -45,12 +30,12 @@ namespace
 	 *
 	 * This function assumes that the given primitive has a box collider.
 	 */
-	bool IsBehindFrontFace(UPrimitiveComponent* Primitive, FVector PointerPosition, float Radius)
+	bool IsBehindFrontFace(UPrimitiveComponent* Primitive, const FUxtFrontFacePokeGeometry& Geometry, FVector PointerPosition, float Radius)
 	{
 		check(Primitive != nullptr);
 
 		// Front face pokables must have a box-shaped collider
-		if (!IsBoxShape(*Primitive))
+		if (!Geometry.bIsBoxShape)
 		{
 			UE_LOG(
 				UXTools, Warning,
@@ -60,15 +45,11 @@ namespace
 			return false;
 		}
 
-		const FMatrix ComponentTransform = Primitive->GetComponentTransform().ToMatrixWithScale();
-
-		FVector LocalPosition = ComponentTransform.InverseTransformPosition(PointerPosition);
-
-		FBoxSphereBounds Bounds = Primitive->CalcLocalBounds();
+		FVector LocalPosition = Geometry.InverseTransform.TransformPosition(PointerPosition);
 
-		float ScaledRadius = Radius / ComponentTransform.GetScaleVector().X;
+		float ScaledRadius = Radius / Geometry.ScaleX;
 
-		if (LocalPosition.X - ScaledRadius < Bounds.BoxExtent.X)
+		if (LocalPosition.X - ScaledRadius < Geometry.LocalExtent.X)
 		{
 			return true;
 		}
@@ -98,12 +79,13 @@ namespace
 	 *
 	 * This function assumes that the given primitive has a box collider.
 	 */
-	bool IsFrontFacePokeEnded(UPrimitiveComponent* Primitive, FVector PointerPosition, float Radius, float Depth)
+	bool IsFrontFacePokeEnded(
+		UPrimitiveComponent* Primitive, const FUxtFrontFacePokeGeometry& Geometry, FVector PointerPosition, float Radius, float Depth)
 	{
 		check(Primitive != nullptr);
 
 		// Front face pokables must have a box-shaped collider
-		if (!IsBoxShape(*Primitive))
+		if (!Geometry.bIsBoxShape)
 		{
 			UE_LOG(
 				UXTools, Warning,
@@ -113,13 +95,9 @@ namespace
 			return false;
 		}
 
-		const FMatrix ComponentTransform = Primitive->GetComponentTransform().ToMatrixNoScale();
+		FVector LocalPosition = Geometry.InverseTransformNoScale.TransformPosition(PointerPosition);
 
-		FVector LocalPosition = ComponentTransform.InverseTransformPosition(PointerPosition);
-
-		FBoxSphereBounds Bounds = Primitive->CalcLocalBounds();
-
-		FVector Max = Bounds.BoxExtent * Primitive->GetComponentTransform().GetScale3D();
+		FVector Max = Geometry.ScaledExtent;
 
 		FVector Min = -Max;
 		Min.X = Max.X - Depth; // depth is measured from the front face
@@ -147,6 +125,7 @@ UUxtNearPointerComponent::UUxtNearPointerComponent()
 
 	GrabFocus = new FUxtGrabPointerFocus();
 	PokeFocus = new FUxtPokePointerFocus();
+	FocusCandidates = new FUxtNearPointerCandidates();
 #if ENABLE_VISUAL_LOG
 	GrabFocus->VLogOwnerWeak = this;
 	PokeFocus->VLogOwnerWeak = this;
@@ -164,6 +143,7 @@ UUxtNearPointerComponent::~UUxtNearPointerComponent()
 {
 	delete GrabFocus;
 	delete PokeFocus;
+	delete FocusCandidates;
 }
 
 void UUxtNearPointerComponent::BeginPlay()
@@ -187,30 +167,28 @@ void UUxtNearPointerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
-static FTransform CalcGrabPointerTransform(EControllerHand Hand)
+static FTransform CalcGrabPointerTransform(const FUxtHandSnapshot& HandSnapshot)
 {
-	FQuat IndexTipOrientation, ThumbTipOrientation;
-	FVector IndexTipPosition, ThumbTipPosition;
-	float IndexTipRadius, ThumbTipRadius;
-	if (IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::IndexTip, IndexTipOrientation, IndexTipPosition, IndexTipRadius) &&
-		IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::ThumbTip, ThumbTipOrientation, ThumbTipPosition, ThumbTipRadius))
+	if (HandSnapshot.bHasJoints)
 	{
+		const int32 IndexTip = (int32)EHandKeypoint::IndexTip;
+		const int32 ThumbTip = (int32)EHandKeypoint::ThumbTip;
+
 		// Use the midway point between the thumb and index finger tips for grab
 		const float LerpFactor = 0.5f;
 		return FTransform(
-			FMath::Lerp(IndexTipOrientation, ThumbTipOrientation, LerpFactor), FMath::Lerp(IndexTipPosition, ThumbTipPosition, LerpFactor));
+			FMath::Lerp(HandSnapshot.JointOrientations[IndexTip], HandSnapshot.JointOrientations[ThumbTip], LerpFactor),
+			FMath::Lerp(HandSnapshot.JointPositions[IndexTip], HandSnapshot.JointPositions[ThumbTip], LerpFactor));
 	}
 	return FTransform::Identity;
 }
 
-static FTransform CalcPokePointerTransform(EControllerHand Hand)
+static FTransform CalcPokePointerTransform(const FUxtHandSnapshot& HandSnapshot)
 {
-	FQuat IndexTipOrientation;
-	FVector IndexTipPosition;
-	float IndexTipRadius;
-	if (IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::IndexTip, IndexTipOrientation, IndexTipPosition, IndexTipRadius))
+	if (HandSnapshot.bHasJoints)
 	{
-		return FTransform(IndexTipOrientation, IndexTipPosition);
+		const int32 IndexTip = (int32)EHandKeypoint::IndexTip;
+		return FTransform(HandSnapshot.JointOrientations[IndexTip], HandSnapshot.JointPositions[IndexTip]);
 	}
 	return FTransform(FQuat::Identity, FVector(FLT_MAX));
 }
@@ -236,8 +214,9 @@ void UUxtNearPointerComponent::UpdateParameterCollection(FVector IndexTipPositio
 void UUxtNearPointerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	// Update cached transforms
-	GrabPointerTransform = CalcGrabPointerTransform(Hand);
-	PokePointerTransform = CalcPokePointerTransform(Hand);
+	const FUxtHandSnapshot& HandSnapshot = IUxtHandTracker::Get().GetHandSnapshot(Hand);
+	GrabPointerTransform = CalcGrabPointerTransform(HandSnapshot);
+	PokePointerTransform = CalcPokePointerTransform(HandSnapshot);
 	UpdateParameterCollection(PokePointerTransform.GetLocation());
 
 	// Unlock focus if targets have been removed,
@@ -263,12 +242,14 @@ void UUxtNearPointerComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 		// Disable complex collision to enable overlap from inside primitives
 		FCollisionQueryParams QueryParams(NAME_None, false);
 
-		TArray<FOverlapResult> Overlaps;
+		// Candidate buffers are reused between frames to avoid reallocation
+		FocusCandidates->Reset();
 		/*bool HasBlockingOverlap = */ GetWorld()->OverlapMultiByChannel(
-			Overlaps, ProximityCenter, FQuat::Identity, TraceChannel, FCollisionShape::MakeSphere(ProximityRadius), QueryParams);
+			FocusCandidates->Overlaps, ProximityCenter, FQuat::Identity, TraceChannel, FCollisionShape::MakeSphere(ProximityRadius),
+			QueryParams);
+		FocusCandidates->Gather();
 
-		GrabFocus->SelectClosestTarget(this, GrabPointerTransform, Overlaps);
-		PokeFocus->SelectClosestTarget(this, PokePointerTransform, Overlaps);
+		FUxtPointerFocus::SelectClosestTargets(this, *FocusCandidates, *GrabFocus, GrabPointerTransform, *PokeFocus, PokePointerTransform);
 	}
 
 	// Update poking state based on poke target
@@ -377,7 +358,9 @@ void UUxtNearPointerComponent::UpdatePokeInteraction()
 			switch (IUxtPokeTarget::Execute_GetPokeBehaviour(Target))
 			{
 			case EUxtPokeBehaviour::FrontFace:
-				endedPoking = IsFrontFacePokeEnded(Primitive, PokePointerLocation, GetPokePointerRadius() + DebounceDepth, PokeDepth);
+				endedPoking = IsFrontFacePokeEnded(
+					Primitive, PokeFocus->GetFrontFaceGeometry(Primitive), PokePointerLocation, GetPokePointerRadius() + DebounceDepth,
+					PokeDepth);
 				break;
 			case EUxtPokeBehaviour::Volume:
 				endedPoking = !Primitive->OverlapComponent(
@@ -389,7 +372,8 @@ void UUxtNearPointerComponent::UpdatePokeInteraction()
 			{
 				PokeFocus->EndPoke(this);
 
-				bWasBehindFrontFace = IsBehindFrontFace(Primitive, PokePointerLocation, GetPokePointerRadius());
+				bWasBehindFrontFace =
+					IsBehindFrontFace(Primitive, PokeFocus->GetFrontFaceGeometry(Primitive), PokePointerLocation, GetPokePointerRadius());
 			}
 			else
 			{
@@ -412,7 +396,7 @@ void UUxtNearPointerComponent::UpdatePokeInteraction()
 		bool isBehind = bWasBehindFrontFace;
 		if (Primitive)
 		{
-			isBehind = IsBehindFrontFace(Primitive, End, GetPokePointerRadius());
+			isBehind = IsBehindFrontFace(Primitive, PokeFocus->GetFrontFaceGeometry(Primitive), End, GetPokePointerRadius());
 		}
 
 		FHitResult HitResult;
@@ -524,12 +508,10 @@ FTransform UUxtNearPointerComponent::GetPokePointerTransform() const
 
 float UUxtNearPointerComponent::GetPokePointerRadius() const
 {
-	FQuat IndexTipOrientation;
-	FVector IndexTipPosition;
-	float IndexTipRadius;
-	if (IUxtHandTracker::Get().GetJointState(Hand, EHandKeypoint::IndexTip, IndexTipOrientation, IndexTipPosition, IndexTipRadius))
+	const FUxtHandSnapshot& HandSnapshot = IUxtHandTracker::Get().GetHandSnapshot(Hand);
+	if (HandSnapshot.bHasJoints)
 	{
-		return IndexTipRadius;
+		return HandSnapshot.JointRadii[(int32)EHandKeypoint::IndexTip];
 	}
 	return 0;
 }
@@ -3,6 +3,16 @@
 
 #include "Input/UxtPointerComponent.h"
 
+#include "Input/UxtInputSubsystem.h"
+
+void UUxtPointerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Queued events are discarded once the pointer is destroyed, dispatch them now including events raised by subclasses on teardown
+	UUxtInputSubsystem::FlushPointerEvents(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 bool UUxtPointerComponent::GetFocusLocked() const
 {
 	return bFocusLocked;
@@ -18,6 +18,78 @@ bool FUxtPointerFocusSearchResult::IsValid() const
 	return (Target != nullptr) && (Primitive != nullptr);
 }
 
+void FUxtNearPointerCandidates::Reset()
+{
+	Overlaps.Reset();
+	Primitives.Reset();
+	TargetFlags.Reset();
+	GrabTargetsStart.Reset();
+	PokeTargetsStart.Reset();
+	TargetsEnd.Reset();
+	TargetComponents.Reset();
+	VisitedPrimitives.Reset();
+}
+
+void FUxtNearPointerCandidates::Gather()
+{
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		AActor* Actor = Overlap.GetActor();
+		UPrimitiveComponent* Primitive = Overlap.GetComponent();
+
+		if (!Actor || !Primitive)
+		{
+			continue;
+		}
+
+		// Primitives with multiple bodies can produce more than one overlap
+		bool bAlreadyVisited = false;
+		VisitedPrimitives.Add(Primitive, &bAlreadyVisited);
+		if (bAlreadyVisited)
+		{
+			continue;
+		}
+
+		const int32 GrabStart = TargetComponents.Num();
+		const int32 NumGrabTargets = AddTargetComponents(Actor, UUxtGrabTarget::StaticClass());
+		const int32 PokeStart = TargetComponents.Num();
+		const int32 NumPokeTargets = AddTargetComponents(Actor, UUxtPokeTarget::StaticClass());
+
+		if (NumGrabTargets > 0 || NumPokeTargets > 0)
+		{
+			Primitives.Add(Primitive);
+			TargetFlags.Add((NumGrabTargets > 0 ? HasGrabTarget : 0) | (NumPokeTargets > 0 ? HasPokeTarget : 0));
+			GrabTargetsStart.Add(GrabStart);
+			PokeTargetsStart.Add(PokeStart);
+			TargetsEnd.Add(TargetComponents.Num());
+		}
+	}
+}
+
+TArrayView<UActorComponent* const> FUxtNearPointerCandidates::GetGrabTargets(int32 Index) const
+{
+	return MakeArrayView(TargetComponents.GetData() + GrabTargetsStart[Index], PokeTargetsStart[Index] - GrabTargetsStart[Index]);
+}
+
+TArrayView<UActorComponent* const> FUxtNearPointerCandidates::GetPokeTargets(int32 Index) const
+{
+	return MakeArrayView(TargetComponents.GetData() + PokeTargetsStart[Index], TargetsEnd[Index] - PokeTargetsStart[Index]);
+}
+
+int32 FUxtNearPointerCandidates::AddTargetComponents(AActor* Actor, UClass* Interface)
+{
+	int32 NumAdded = 0;
+	for (const TWeakObjectPtr<UActorComponent>& ComponentWeak : UUxtInputSubsystem::GetInterfaceComponents(Actor, Interface))
+	{
+		if (UActorComponent* Component = ComponentWeak.Get())
+		{
+			TargetComponents.Add(Component);
+			++NumAdded;
+		}
+	}
+	return NumAdded;
+}
+
 const FVector& FUxtPointerFocus::GetClosestTargetPoint() const
 {
 	return ClosestTargetPoint;
@@ -50,11 +122,31 @@ UObject* FUxtPointerFocus::GetFocusedTargetChecked() const
 	return nullptr;
 }
 
-void FUxtPointerFocus::SelectClosestTarget(
-	UUxtNearPointerComponent* Pointer, const FTransform& PointerTransform, const TArray<FOverlapResult>& Overlaps)
+void FUxtPointerFocus::SelectClosestTargets(
+	UUxtNearPointerComponent* Pointer, const FUxtNearPointerCandidates& Candidates, FUxtPointerFocus& GrabFocus,
+	const FTransform& GrabPointerTransform, FUxtPointerFocus& PokeFocus, const FTransform& PokePointerTransform)
 {
-	FUxtPointerFocusSearchResult Result = FindClosestTarget(Overlaps, PointerTransform.GetLocation());
-	SetFocus(Pointer, PointerTransform, Result);
+	const FVector GrabPoint = GrabPointerTransform.GetLocation();
+	const FVector PokePoint = PokePointerTransform.GetLocation();
+
+	FUxtPointerFocusSearchResult GrabResult = {nullptr, nullptr, FVector::ZeroVector, FVector::ForwardVector, MAX_FLT};
+	FUxtPointerFocusSearchResult PokeResult = {nullptr, nullptr, FVector::ZeroVector, FVector::ForwardVector, MAX_FLT};
+
+	for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+	{
+		const uint8 Flags = Candidates.TargetFlags[Index];
+		if (Flags & FUxtNearPointerCandidates::HasGrabTarget)
+		{
+			GrabFocus.EvaluateCandidate(Candidates, Index, GrabPoint, GrabResult);
+		}
+		if (Flags & FUxtNearPointerCandidates::HasPokeTarget)
+		{
+			PokeFocus.EvaluateCandidate(Candidates, Index, PokePoint, PokeResult);
+		}
+	}
+
+	GrabFocus.SetFocus(Pointer, GrabPointerTransform, GrabFocus.FinalizeSearchResult(GrabResult));
+	PokeFocus.SetFocus(Pointer, PokePointerTransform, PokeFocus.FinalizeSearchResult(PokeResult));
 }
 
 void FUxtPointerFocus::UpdateClosestTarget(const FTransform& PointerTransform)
@@ -158,9 +250,9 @@ void FUxtPointerFocus::SetFocus(
 /** Find a component of the actor that implements the given interface type. */
 UActorComponent* FUxtPointerFocus::FindInterfaceComponent(AActor* Owner) const
 {
-	for (UActorComponent* Component : Owner->GetComponents())
+	for (const TWeakObjectPtr<UActorComponent>& ComponentWeak : UUxtInputSubsystem::GetInterfaceComponents(Owner, GetInterfaceClass()))
 	{
-		if (ImplementsTargetInterface(Component))
+		if (UActorComponent* Component = ComponentWeak.Get())
 		{
 			return Component;
 		}
@@ -168,59 +260,44 @@ UActorComponent* FUxtPointerFocus::FindInterfaceComponent(AActor* Owner) const
 	return nullptr;
 }
 
-FUxtPointerFocusSearchResult FUxtPointerFocus::FindClosestTarget(const TArray<FOverlapResult>& Overlaps, const FVector& Point) const
+void FUxtPointerFocus::EvaluateCandidate(
+	const FUxtNearPointerCandidates& Candidates, int32 Index, const FVector& Point, FUxtPointerFocusSearchResult& InOutResult) const
 {
-	float MinDistanceSqr = MAX_FLT;
-	UActorComponent* ClosestTarget = nullptr;
-	UPrimitiveComponent* ClosestPrimitive = nullptr;
-	FVector ClosestPointOnTarget = FVector::ZeroVector;
-	FVector ClosestNormal = FVector::ForwardVector;
+	UPrimitiveComponent* Primitive = Candidates.Primitives[Index];
 
-	for (const FOverlapResult& Overlap : Overlaps)
+	for (UActorComponent* Component : GetCandidateTargets(Candidates, Index))
 	{
-		AActor* Actor = Overlap.GetActor();
-		UPrimitiveComponent* Primitive = Overlap.GetComponent();
+		FVector PointOnTarget;
+		FVector Normal;
 
-		if (Actor && Primitive)
+		if (GetClosestPointOnTarget(Component, Primitive, Point, PointOnTarget, Normal))
 		{
-			for (UActorComponent* Component : Actor->GetComponents())
+			// MinDistance holds the squared distance until the search is finalized
+			float DistanceSqr = (Point - PointOnTarget).SizeSquared();
+			if (DistanceSqr < InOutResult.MinDistance)
 			{
-				if (ImplementsTargetInterface(Component))
-				{
-					FVector PointOnTarget;
-					FVector Normal;
-
-					if (GetClosestPointOnTarget(Component, Primitive, Point, PointOnTarget, Normal))
-					{
-						float DistanceSqr = (Point - PointOnTarget).SizeSquared();
-						if (DistanceSqr < MinDistanceSqr)
-						{
-							MinDistanceSqr = DistanceSqr;
-							ClosestTarget = Component;
-							ClosestPrimitive = Primitive;
-							ClosestPointOnTarget = PointOnTarget;
-							ClosestNormal = Normal;
-						}
+				InOutResult = {Component, Primitive, PointOnTarget, Normal, DistanceSqr};
+			}
 
 #if ENABLE_VISUAL_LOG
-						VLogFocus(Overlap.GetComponent(), PointOnTarget, Normal, false);
+			VLogFocus(Primitive, PointOnTarget, Normal, false);
 #endif // ENABLE_VISUAL_LOG
 
-						// We keep the first target component that takes ownership of the primitive.
-						break;
-					}
-				}
-			}
+			// We keep the first target component that takes ownership of the primitive.
+			break;
 		}
 	}
+}
 
-	if (ClosestTarget != nullptr)
+FUxtPointerFocusSearchResult FUxtPointerFocus::FinalizeSearchResult(const FUxtPointerFocusSearchResult& Result) const
+{
+	if (Result.Target != nullptr)
 	{
 #if ENABLE_VISUAL_LOG
-		VLogFocus(ClosestPrimitive, ClosestPointOnTarget, ClosestNormal, true);
+		VLogFocus(Result.Primitive, Result.ClosestPointOnTarget, Result.Normal, true);
 #endif // ENABLE_VISUAL_LOG
 
-		return {ClosestTarget, ClosestPrimitive, ClosestPointOnTarget, ClosestNormal, FMath::Sqrt(MinDistanceSqr)};
+		return {Result.Target, Result.Primitive, Result.ClosestPointOnTarget, Result.Normal, FMath::Sqrt(Result.MinDistance)};
 	}
 	else
 	{
@@ -337,6 +414,11 @@ bool FUxtGrabPointerFocus::ImplementsTargetInterface(UObject* Target) const
 	return Target->Implements<UUxtGrabTarget>();
 }
 
+TArrayView<UActorComponent* const> FUxtGrabPointerFocus::GetCandidateTargets(const FUxtNearPointerCandidates& Candidates, int32 Index) const
+{
+	return Candidates.GetGrabTargets(Index);
+}
+
 bool FUxtGrabPointerFocus::GetClosestPointOnTarget(
 	const UActorComponent* Target, const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutClosestPoint,
 	FVector& OutNormal) const
@@ -407,6 +489,32 @@ bool FUxtPokePointerFocus::IsPoking() const
 	return bIsPoking;
 }
 
+const FUxtFrontFacePokeGeometry& FUxtPokePointerFocus::GetFrontFaceGeometry(UPrimitiveComponent* Primitive)
+{
+	const TWeakObjectPtr<const UPrimitiveComponent> Key(Primitive);
+	FUxtFrontFacePokeGeometry* Geometry = FrontFaceGeometryCache.Find(Key);
+	if (!Geometry)
+	{
+		if (FrontFaceGeometryCache.Num() >= FrontFaceGeometryCachePruneSize)
+		{
+			for (auto It = FrontFaceGeometryCache.CreateIterator(); It; ++It)
+			{
+				if (!It.Key().IsValid())
+				{
+					It.RemoveCurrent();
+				}
+			}
+
+			FrontFaceGeometryCachePruneSize = FMath::Max(16, FrontFaceGeometryCache.Num() * 2);
+		}
+
+		Geometry = &FrontFaceGeometryCache.Add(Key);
+	}
+
+	Geometry->Update(Primitive);
+	return *Geometry;
+}
+
 UClass* FUxtPokePointerFocus::GetInterfaceClass() const
 {
 	return UUxtPokeTarget::StaticClass();
@@ -417,6 +525,11 @@ bool FUxtPokePointerFocus::ImplementsTargetInterface(UObject* Target) const
 	return Target->Implements<UUxtPokeTarget>();
 }
 
+TArrayView<UActorComponent* const> FUxtPokePointerFocus::GetCandidateTargets(const FUxtNearPointerCandidates& Candidates, int32 Index) const
+{
+	return Candidates.GetPokeTargets(Index);
+}
+
 bool FUxtPokePointerFocus::GetClosestPointOnTarget(
 	const UActorComponent* Target, const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutClosestPoint,
 	FVector& OutNormal) const
@@ -7,9 +7,11 @@
 #include "EngineDefines.h"
 
 #include "Engine/EngineTypes.h"
+#include "Input/UxtFrontFacePokeGeometry.h"
 
 class UUxtNearPointerComponent;
 class UActorComponent;
+class UBodySetup;
 class UPrimitiveComponent;
 
 /** Result of closest point search functions. */
@@ -33,6 +35,61 @@ struct FUxtPointerFocusSearchResult
 	float MinDistance;
 };
 
+/**
+ * Candidate primitives for the near pointer focus search, shared by the grab and poke focus.
+ * Stored as a structure of arrays which keeps its allocations between frames.
+ * Component transforms are not stored, closest point queries take the primitive and read its body transforms themselves.
+ */
+struct FUxtNearPointerCandidates
+{
+public:
+	/** Flags describing which target interfaces are implemented on the owner of a candidate primitive. */
+	enum ETargetFlags : uint8
+	{
+		HasGrabTarget = 1 << 0,
+		HasPokeTarget = 1 << 1,
+	};
+
+	/** Remove all candidates, keeping the allocated memory. */
+	void Reset();
+
+	/** Add the overlapping primitives along with the target components of their owners. */
+	void Gather();
+
+	/** Number of candidate primitives. */
+	int32 Num() const { return Primitives.Num(); }
+
+	/** Grab target components of the actor owning the given candidate. */
+	TArrayView<UActorComponent* const> GetGrabTargets(int32 Index) const;
+
+	/** Poke target components of the actor owning the given candidate. */
+	TArrayView<UActorComponent* const> GetPokeTargets(int32 Index) const;
+
+	/** Results of the proximity overlap query, filled in by the pointer before gathering. */
+	TArray<FOverlapResult> Overlaps;
+
+	/** Candidate primitives, each primitive is only added once. */
+	TArray<UPrimitiveComponent*> Primitives;
+
+	/** Combination of ETargetFlags for each candidate primitive. */
+	TArray<uint8> TargetFlags;
+
+	/** Ranges of the grab and poke targets of each candidate in the TargetComponents array. */
+	TArray<int32> GrabTargetsStart;
+	TArray<int32> PokeTargetsStart;
+	TArray<int32> TargetsEnd;
+
+	/** Target components of all candidates, in contiguous ranges per candidate. */
+	TArray<UActorComponent*> TargetComponents;
+
+private:
+	/** Append the components implementing the interface to the target array, returns the number of components added. */
+	int32 AddTargetComponents(AActor* Actor, UClass* Interface);
+
+	/** Overlapping primitives already seen while gathering, including those without targets. */
+	TSet<UPrimitiveComponent*> VisitedPrimitives;
+};
+
 /** Utility class that is used by components to manage different pointers and their focus targets. */
 struct FUxtPointerFocus
 {
@@ -58,8 +115,13 @@ public:
 
 	// TODO get hand joints from WMR => no need to pass PointerTransform
 
-	/** Select and set the focused target among the list of overlaps. */
-	void SelectClosestTarget(UUxtNearPointerComponent* Pointer, const FTransform& PointerTransform, const TArray<FOverlapResult>& Overlaps);
+	/**
+	 * Select and set the focused targets of both the grab and the poke focus.
+	 * Candidates are evaluated for both pointer positions in a single pass.
+	 */
+	static void SelectClosestTargets(
+		UUxtNearPointerComponent* Pointer, const FUxtNearPointerCandidates& Candidates, FUxtPointerFocus& GrabFocus,
+		const FTransform& GrabPointerTransform, FUxtPointerFocus& PokeFocus, const FTransform& PokePointerTransform);
 
 	/** Update the ClosestTargetPoint while focus is locked */
 	void UpdateClosestTarget(const FTransform& PointerTransform);
@@ -89,8 +151,15 @@ protected:
 	/** Set the focus to the given target object, primitive, and point on the target. */
 	void SetFocus(UUxtNearPointerComponent* Pointer, const FTransform& PointerTransform, const FUxtPointerFocusSearchResult& FocusResult);
 
-	/** Find the closest target object, primitive, and point among the overlaps. */
-	FUxtPointerFocusSearchResult FindClosestTarget(const TArray<FOverlapResult>& Overlaps, const FVector& Point) const;
+	/** Update the search result if the given candidate is closer to the point than the current result. */
+	void EvaluateCandidate(
+		const FUxtNearPointerCandidates& Candidates, int32 Index, const FVector& Point, FUxtPointerFocusSearchResult& InOutResult) const;
+
+	/** Finish the search, logging the result. */
+	FUxtPointerFocusSearchResult FinalizeSearchResult(const FUxtPointerFocusSearchResult& Result) const;
+
+	/** Get the target components of the given candidate that implement the required target interface. */
+	virtual TArrayView<UActorComponent* const> GetCandidateTargets(const FUxtNearPointerCandidates& Candidates, int32 Index) const = 0;
 
 	/** Find the closest primitive and point on the owner of the given component. */
 	FUxtPointerFocusSearchResult FindClosestPointOnComponent(UActorComponent* Target, const FVector& Point) const;
@@ -149,6 +218,8 @@ protected:
 
 	virtual bool ImplementsTargetInterface(UObject* Target) const override;
 
+	virtual TArrayView<UActorComponent* const> GetCandidateTargets(const FUxtNearPointerCandidates& Candidates, int32 Index) const override;
+
 	virtual bool GetClosestPointOnTarget(
 		const UActorComponent* Target, const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutClosestPoint,
 		FVector& OutNormal) const override;
@@ -174,11 +245,16 @@ public:
 
 	bool IsPoking() const;
 
+	/** Get the front face poke geometry of the given primitive. */
+	const FUxtFrontFacePokeGeometry& GetFrontFaceGeometry(UPrimitiveComponent* Primitive);
+
 protected:
 	virtual UClass* GetInterfaceClass() const override;
 
 	virtual bool ImplementsTargetInterface(UObject* Target) const override;
 
+	virtual TArrayView<UActorComponent* const> GetCandidateTargets(const FUxtNearPointerCandidates& Candidates, int32 Index) const override;
+
 	virtual bool GetClosestPointOnTarget(
 		const UActorComponent* Target, const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutClosestPoint,
 		FVector& OutNormal) const override;
@@ -189,4 +265,10 @@ protected:
 
 private:
 	bool bIsPoking = false;
+
+	/** Cached geometry of front face pokable primitives, destroyed primitives are pruned as the cache grows. */
+	TMap<TWeakObjectPtr<const UPrimitiveComponent>, FUxtFrontFacePokeGeometry> FrontFaceGeometryCache;
+
+	/** Cache size at which stale geometry entries are pruned next. */
+	int32 FrontFaceGeometryCachePruneSize = 16;
 };
@@ -4,8 +4,6 @@
 #include "Interactions/Constraints/UxtFaceUserConstraint.h"
 
 #include "Components/ActorComponent.h"
-#include "Engine/World.h"
-#include "Utils/UxtFunctionLibrary.h"
 
 EUxtTransformMode UUxtFaceUserConstraint::GetConstraintType() const
 {
@@ -14,7 +12,7 @@ EUxtTransformMode UUxtFaceUserConstraint::GetConstraintType() const
 
 void UUxtFaceUserConstraint::ApplyConstraint(FTransform& Transform) const
 {
-	FVector DirectionToTarget = Transform.GetLocation() - UUxtFunctionLibrary::GetHeadPose(GetWorld()).GetLocation();
+	FVector DirectionToTarget = Transform.GetLocation() - GetHeadPose().GetLocation();
 	FQuat OrientationToUser = FRotationMatrix::MakeFromXZ(bFaceAway ? DirectionToTarget : -DirectionToTarget, FVector::UpVector).ToQuat();
 	Transform.SetRotation(OrientationToUser);
 }
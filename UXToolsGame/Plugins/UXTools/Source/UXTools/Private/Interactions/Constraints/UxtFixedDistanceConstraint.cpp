@@ -27,16 +27,24 @@ void UUxtFixedDistanceConstraint::ApplyConstraint(FTransform& Transform) const
 	Transform.SetLocation(ConstraintLocation + ConstraintToPose);
 }
 
-FVector UUxtFixedDistanceConstraint::GetConstraintLocation() const
+bool UUxtFixedDistanceConstraint::UsesHeadPose() const
 {
 	// FComponentReference doesn't override the != operator
-	if (!(ConstraintComponent == FComponentReference()))
+	return ConstraintComponent == FComponentReference();
+}
+
+FVector UUxtFixedDistanceConstraint::GetConstraintLocation() const
+{
+	if (UsesHeadPose())
+	{
+		return GetHeadPose().GetLocation();
+	}
+
+	if (USceneComponent* Component = UUxtFunctionLibrary::GetSceneComponentFromReference(ConstraintComponent, GetOwner()))
 	{
-		if (USceneComponent* Component = UUxtFunctionLibrary::GetSceneComponentFromReference(ConstraintComponent, GetOwner()))
-		{
-			return Component->GetComponentLocation();
-		}
+		return Component->GetComponentLocation();
 	}
 
+	// The referenced component doesn't exist, fall back to the head
 	return UUxtFunctionLibrary::GetHeadPose(GetWorld()).GetLocation();
 }
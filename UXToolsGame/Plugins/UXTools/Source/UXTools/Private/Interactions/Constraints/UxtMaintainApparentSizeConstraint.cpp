@@ -3,14 +3,11 @@
 
 #include "Interactions/Constraints/UxtMaintainApparentSizeConstraint.h"
 
-#include "Engine/World.h"
-#include "Utils/UxtFunctionLibrary.h"
-
 void UUxtMaintainApparentSizeConstraint::Initialize(const FTransform& WorldPose)
 {
 	Super::Initialize(WorldPose);
 
-	InitialDistance = FVector::Dist(WorldPose.GetLocation(), UUxtFunctionLibrary::GetHeadPose(GetWorld()).GetLocation());
+	InitialDistance = FVector::Dist(WorldPose.GetLocation(), GetHeadPose().GetLocation());
 }
 
 EUxtTransformMode UUxtMaintainApparentSizeConstraint::GetConstraintType() const
@@ -20,6 +17,6 @@ EUxtTransformMode UUxtMaintainApparentSizeConstraint::GetConstraintType() const
 
 void UUxtMaintainApparentSizeConstraint::ApplyConstraint(FTransform& Transform) const
 {
-	const float CurrentDistance = FVector::Dist(Transform.GetLocation(), UUxtFunctionLibrary::GetHeadPose(GetWorld()).GetLocation());
+	const float CurrentDistance = FVector::Dist(Transform.GetLocation(), GetHeadPose().GetLocation());
 	Transform.SetScale3D((CurrentDistance / InitialDistance) * WorldPoseOnManipulationStart.GetScale3D());
 }
@@ -10,3 +10,18 @@ void UUxtTransformConstraint::Initialize(const FTransform& WorldPose)
 {
 	WorldPoseOnManipulationStart = WorldPose;
 }
+
+void UUxtTransformConstraint::SetHeadPose(const FTransform& NewHeadPose) const
+{
+	HeadPose = NewHeadPose;
+	HeadPoseFrame = GFrameCounter;
+}
+
+const FTransform& UUxtTransformConstraint::GetHeadPose() const
+{
+	if (HeadPoseFrame != GFrameCounter)
+	{
+		SetHeadPose(UUxtFunctionLibrary::GetHeadPose(GetWorld()));
+	}
+	return HeadPose;
+}
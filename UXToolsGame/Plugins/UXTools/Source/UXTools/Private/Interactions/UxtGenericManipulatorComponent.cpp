@@ -127,7 +127,7 @@ void UUxtGenericManipulatorComponent::UpdateOneHandManipulation(float DeltaTime)
 	MoveToTargets(TargetTransform, TargetTransform, OneHandRotationMode != EUxtOneHandRotationMode::RotateAboutObjectCenter);
 	ApplyConstraints(TargetTransform, EUxtTransformMode::Translation, true, IsNearManipulation());
 
-	SmoothTransform(TargetTransform, LerpTime, LerpTime, DeltaTime, TargetTransform);
+	ApplySmoothing(DeltaTime, TargetTransform);
 
 	ApplyTargetTransform(TargetTransform);
 }
@@ -159,11 +159,24 @@ void UUxtGenericManipulatorComponent::UpdateTwoHandManipulation(float DeltaTime)
 		ApplyConstraints(TargetTransform, EUxtTransformMode::Translation, false, IsNearManipulation());
 	}
 
-	SmoothTransform(TargetTransform, LerpTime, LerpTime, DeltaTime, TargetTransform);
+	ApplySmoothing(DeltaTime, TargetTransform);
 
 	ApplyTargetTransform(TargetTransform);
 }
 
+void UUxtGenericManipulatorComponent::ApplySmoothing(float DeltaTime, FTransform& InOutTargetTransform)
+{
+	if (bUseAdaptiveSmoothing)
+	{
+		AdaptiveSmoothTransform(
+			InOutTargetTransform, AdaptiveLocationSmoothing, AdaptiveRotationSmoothing, DeltaTime, InOutTargetTransform);
+	}
+	else
+	{
+		SmoothTransform(InOutTargetTransform, LerpTime, LerpTime, DeltaTime, InOutTargetTransform);
+	}
+}
+
 void UUxtGenericManipulatorComponent::OnGrab(UUxtGrabTargetComponent* Grabbable, FUxtGrabPointerData GrabPointer)
 {
 	InitializeConstraints(TransformTarget);
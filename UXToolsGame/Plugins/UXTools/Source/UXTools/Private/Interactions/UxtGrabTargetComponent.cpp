@@ -6,6 +6,7 @@
 #include "Engine/World.h"
 #include "HandTracking/IUxtHandTracker.h"
 #include "Input/UxtFarPointerComponent.h"
+#include "Input/UxtInputSubsystem.h"
 #include "Input/UxtNearPointerComponent.h"
 #include "Interactions/UxtInteractionMode.h"
 #include "Interactions/UxtInteractionUtils.h"
@@ -289,6 +290,18 @@ void UUxtGrabTargetComponent::BeginPlay()
 	UpdateComponentTickEnabled();
 }
 
+void UUxtGrabTargetComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtInputSubsystem::RegisterInterfaceComponent(this);
+}
+
+void UUxtGrabTargetComponent::OnUnregister()
+{
+	UUxtInputSubsystem::UnregisterInterfaceComponent(this);
+	Super::OnUnregister();
+}
+
 bool UUxtGrabTargetComponent::IsGrabFocusable_Implementation(const UPrimitiveComponent* Primitive) const
 {
 	// We treat all primitives in the actor as grabbable by default.
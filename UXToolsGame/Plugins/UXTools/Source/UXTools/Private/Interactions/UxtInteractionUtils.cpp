@@ -5,6 +5,119 @@
 
 #include "Components/PrimitiveComponent.h"
 #include "GameFramework/Actor.h"
+#include "PhysicsEngine/BodySetup.h"
+
+namespace
+{
+	/** Closest point on a box element, in the space of the element's parent. */
+	FVector GetClosestPointOnElem(const FKBoxElem& Elem, const FVector& Point)
+	{
+		const FTransform ElemTransform = Elem.GetTransform();
+		const FVector Extent(Elem.X * 0.5f, Elem.Y * 0.5f, Elem.Z * 0.5f);
+		const FVector LocalPoint = ElemTransform.InverseTransformPositionNoScale(Point);
+		return ElemTransform.TransformPositionNoScale(LocalPoint.BoundToBox(-Extent, Extent));
+	}
+
+	/** Closest point on a sphere element, in the space of the element's parent. */
+	FVector GetClosestPointOnElem(const FKSphereElem& Elem, const FVector& Point)
+	{
+		const FVector Delta = Point - Elem.Center;
+		if (Delta.SizeSquared() <= FMath::Square(Elem.Radius))
+		{
+			return Point;
+		}
+		return Elem.Center + Delta.GetUnsafeNormal() * Elem.Radius;
+	}
+
+	/** Closest point on a capsule element, in the space of the element's parent. */
+	FVector GetClosestPointOnElem(const FKSphylElem& Elem, const FVector& Point)
+	{
+		const FTransform ElemTransform = Elem.GetTransform();
+		const FVector LocalPoint = ElemTransform.InverseTransformPositionNoScale(Point);
+
+		// Capsule segment is aligned with the Z axis of the element
+		const float HalfLength = Elem.Length * 0.5f;
+		const FVector SegmentPoint(0.0f, 0.0f, FMath::Clamp(LocalPoint.Z, -HalfLength, HalfLength));
+		const FVector Delta = LocalPoint - SegmentPoint;
+		if (Delta.SizeSquared() <= FMath::Square(Elem.Radius))
+		{
+			return Point;
+		}
+		return ElemTransform.TransformPositionNoScale(SegmentPoint + Delta.GetUnsafeNormal() * Elem.Radius);
+	}
+
+	/** Find the closest point among a list of shape elements, scaled by the component scale. */
+	template <typename ElemType>
+	void GetClosestPointOnElems(
+		const TArray<ElemType>& Elems, const FVector& Scale3D, const FVector& LocalPoint, FVector& InOutClosestPoint,
+		float& InOutDistanceSqr)
+	{
+		for (const ElemType& Elem : Elems)
+		{
+			const ElemType ScaledElem = Elem.GetFinalScaled(Scale3D, FTransform::Identity);
+			const FVector ClosestPoint = GetClosestPointOnElem(ScaledElem, LocalPoint);
+			const float DistanceSqr = FVector::DistSquared(ClosestPoint, LocalPoint);
+			if (DistanceSqr < InOutDistanceSqr)
+			{
+				InOutClosestPoint = ClosestPoint;
+				InOutDistanceSqr = DistanceSqr;
+			}
+		}
+	}
+
+	/**
+	 * Solve the closest point in closed form for primitives whose collision consists only of boxes, spheres and capsules.
+	 * Returns false if the primitive uses other shapes, in which case the physics engine has to be queried.
+	 */
+	bool GetClosestPointOnSimpleShapes(
+		const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutClosestPoint, float& OutDistanceSqr)
+	{
+		// Only single-body primitives are solved here. Multi-body components such as skeletal meshes return the root bone's
+		// body, whose shapes are in bone space and which ignores all other bodies.
+		const FBodyInstance* BodyInstance = Primitive->GetBodyInstance();
+		if (BodyInstance != &Primitive->BodyInstance || !BodyInstance->IsValidBodyInstance() || BodyInstance->WeldParent)
+		{
+			return false;
+		}
+
+		const UBodySetup* BodySetup = BodyInstance->BodySetup.Get();
+		if (!BodySetup || BodySetup->GetCollisionTraceFlag() == CTF_UseComplexAsSimple)
+		{
+			return false;
+		}
+
+		const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+		const int32 NumSimpleElems = AggGeom.BoxElems.Num() + AggGeom.SphereElems.Num() + AggGeom.SphylElems.Num();
+		if (NumSimpleElems == 0 || NumSimpleElems != AggGeom.GetElementCount())
+		{
+			return false;
+		}
+
+		// Solve in unscaled component space, scale is applied to the shape elements in the same way as for physics bodies
+		const FTransform& ComponentTransform = Primitive->GetComponentTransform();
+		const FVector Scale3D = ComponentTransform.GetScale3D();
+		const FVector LocalPoint = ComponentTransform.InverseTransformPositionNoScale(Point);
+
+		FVector LocalClosestPoint = LocalPoint;
+		float DistanceSqr = MAX_FLT;
+		GetClosestPointOnElems(AggGeom.BoxElems, Scale3D, LocalPoint, LocalClosestPoint, DistanceSqr);
+		GetClosestPointOnElems(AggGeom.SphereElems, Scale3D, LocalPoint, LocalClosestPoint, DistanceSqr);
+		GetClosestPointOnElems(AggGeom.SphylElems, Scale3D, LocalPoint, LocalClosestPoint, DistanceSqr);
+
+		if (DistanceSqr <= 0.0f)
+		{
+			// Point is inside the collision, same as the physics query
+			OutClosestPoint = Point;
+			OutDistanceSqr = 0.0f;
+		}
+		else
+		{
+			OutClosestPoint = ComponentTransform.TransformPositionNoScale(LocalClosestPoint);
+			OutDistanceSqr = DistanceSqr;
+		}
+		return true;
+	}
+} // namespace
 
 bool FUxtInteractionUtils::GetDefaultClosestPointOnPrimitive(
 	const UPrimitiveComponent* Primitive, const FVector& Point, FVector& OutPointOnSurface, float& OutDistanceSqr)
@@ -17,7 +130,8 @@ bool FUxtInteractionUtils::GetDefaultClosestPointOnPrimitive(
 		FVector ClosestPoint;
 		float DistanceSqr = -1.f;
 
-		if (Primitive->GetSquaredDistanceToCollision(Point, DistanceSqr, ClosestPoint))
+		if (GetClosestPointOnSimpleShapes(Primitive, Point, ClosestPoint, DistanceSqr) ||
+			Primitive->GetSquaredDistanceToCollision(Point, DistanceSqr, ClosestPoint))
 		{
 			OutPointOnSurface = ClosestPoint;
 			OutDistanceSqr = DistanceSqr;
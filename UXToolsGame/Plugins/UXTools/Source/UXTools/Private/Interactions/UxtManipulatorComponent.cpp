@@ -5,11 +5,35 @@
 
 #include "UXTools.h"
 
+#include "Utils/UxtFunctionLibrary.h"
+
 namespace
 {
 	const float kRelativeScaleFloor = 0.01f;
 	const float kRelativeScaleCeiling = 1.0f;
 
+	/** Index of the constraint bucket for the transform mode, hand count and interaction mode, INDEX_NONE for invalid modes. */
+	int32 GetConstraintBucketIndex(EUxtTransformMode TransformMode, bool bIsOneHanded, bool bIsNear)
+	{
+		int32 ModeIndex;
+		switch (TransformMode)
+		{
+		case EUxtTransformMode::Translation:
+			ModeIndex = 0;
+			break;
+		case EUxtTransformMode::Rotation:
+			ModeIndex = 1;
+			break;
+		case EUxtTransformMode::Scaling:
+			ModeIndex = 2;
+			break;
+		default:
+			return INDEX_NONE;
+		}
+
+		return ModeIndex * 4 + (bIsOneHanded ? 0 : 2) + (bIsNear ? 0 : 1);
+	}
+
 	void ApplyImplicitScalingConstraint(FTransform& Transform, const FVector& MinScale, const FVector& MaxScale)
 	{
 		FVector ConstrainedScale = Transform.GetScale3D();
@@ -158,26 +182,33 @@ void UUxtManipulatorComponent::InitializeConstraints(USceneComponent* NewTargetC
 	{
 		Constraint->Initialize(TargetComponent->GetComponentTransform());
 	}
+
+	CompileConstraintBuckets();
 }
 
 void UUxtManipulatorComponent::ApplyConstraints(
 	FTransform& Transform, EUxtTransformMode TransformMode, bool bIsOneHanded, bool bIsNear) const
 {
-	const int32 GrabMode = static_cast<int32>(bIsOneHanded ? EUxtGrabMode::OneHanded : EUxtGrabMode::TwoHanded);
-	const int32 InteractionMode = static_cast<int32>(bIsNear ? EUxtInteractionMode::Near : EUxtInteractionMode::Far);
-
 	if (TransformMode == EUxtTransformMode::Scaling)
 	{
 		ApplyImplicitScalingConstraint(Transform, GetMinScaleVec(), GetMaxScaleVec());
 	}
 
-	for (const UUxtTransformConstraint* Constraint : ActiveConstraints)
+	const int32 BucketIndex = GetConstraintBucketIndex(TransformMode, bIsOneHanded, bIsNear);
+	if (BucketIndex == INDEX_NONE)
 	{
-		if (Constraint->GetConstraintType() == TransformMode && Constraint->HandType & GrabMode &&
-			Constraint->InteractionMode & InteractionMode)
-		{
-			Constraint->ApplyConstraint(Transform);
-		}
+		return;
+	}
+
+	const FUxtConstraintBucket& Bucket = ConstraintBuckets[BucketIndex];
+	if (Bucket.bUsesHeadPose)
+	{
+		UpdateConstraintHeadPose();
+	}
+
+	for (const UUxtTransformConstraint* Constraint : Bucket.Constraints)
+	{
+		Constraint->ApplyConstraint(Transform);
 	}
 }
 
@@ -236,6 +267,59 @@ void UUxtManipulatorComponent::UpdateActiveConstraints()
 	if (NewConstraints > 0 || ExistingConstraints < ActiveConstraints.Num())
 	{
 		ActiveConstraints = Constraints;
+		CompileConstraintBuckets();
+	}
+}
+
+void UUxtManipulatorComponent::CompileConstraintBuckets()
+{
+	for (FUxtConstraintBucket& Bucket : ConstraintBuckets)
+	{
+		Bucket.Constraints.Reset();
+		Bucket.bUsesHeadPose = false;
+	}
+	HeadPoseConstraints.Reset();
+
+	// Constraint type and filters are only evaluated here, when the grab starts or the set of constraints changes
+	for (UUxtTransformConstraint* Constraint : ActiveConstraints)
+	{
+		const bool bUsesHeadPose = Constraint->UsesHeadPose();
+		if (bUsesHeadPose)
+		{
+			HeadPoseConstraints.Add(Constraint);
+		}
+
+		for (const bool bIsOneHanded : {true, false})
+		{
+			const int32 GrabMode = static_cast<int32>(bIsOneHanded ? EUxtGrabMode::OneHanded : EUxtGrabMode::TwoHanded);
+			for (const bool bIsNear : {true, false})
+			{
+				const int32 InteractionMode = static_cast<int32>(bIsNear ? EUxtInteractionMode::Near : EUxtInteractionMode::Far);
+				const int32 BucketIndex = GetConstraintBucketIndex(Constraint->GetConstraintType(), bIsOneHanded, bIsNear);
+				if (BucketIndex != INDEX_NONE && Constraint->HandType & GrabMode && Constraint->InteractionMode & InteractionMode)
+				{
+					ConstraintBuckets[BucketIndex].Constraints.Add(Constraint);
+					ConstraintBuckets[BucketIndex].bUsesHeadPose |= bUsesHeadPose;
+				}
+			}
+		}
+	}
+
+	// Make sure that the head pose is fetched again for new constraints
+	HeadPoseFrame = 0;
+}
+
+void UUxtManipulatorComponent::UpdateConstraintHeadPose() const
+{
+	if (HeadPoseFrame != GFrameCounter)
+	{
+		HeadPoseFrame = GFrameCounter;
+
+		const FTransform HeadPose = UUxtFunctionLibrary::GetHeadPose(GetWorld());
+		for (UUxtTransformConstraint* Constraint : HeadPoseConstraints)
+		{
+			Constraint->SetHeadPose(HeadPose);
+		}
 	}
 }
 
@@ -135,6 +135,23 @@ void UUxtManipulatorComponentBase::SmoothTransform(
 	TargetTransform.SetComponents(SmoothRot, SmoothLoc, SourceTransform.GetScale3D());
 }
 
+void UUxtManipulatorComponentBase::AdaptiveSmoothTransform(
+	const FTransform& SourceTransform, const FUxtOneEuroFilterSettings& LocationSettings,
+	const FUxtOneEuroFilterSettings& RotationSettings, float DeltaSeconds, FTransform& TargetTransform)
+{
+	if (!LocationFilter.HasValue() || !RotationFilter.HasValue())
+	{
+		const FTransform CurTransform = TransformTarget->GetComponentTransform();
+		LocationFilter.Reset(CurTransform.GetLocation());
+		RotationFilter.Reset(CurTransform.GetRotation());
+	}
+
+	const FVector SmoothLoc = LocationFilter.Filter(SourceTransform.GetLocation(), DeltaSeconds, LocationSettings);
+	const FQuat SmoothRot = RotationFilter.Filter(SourceTransform.GetRotation(), DeltaSeconds, RotationSettings);
+
+	TargetTransform.SetComponents(SmoothRot, SmoothLoc, SourceTransform.GetScale3D());
+}
+
 void UUxtManipulatorComponentBase::SetInitialTransform()
 {
 	InitialTransform = TransformTarget->GetComponentTransform();
@@ -183,6 +200,12 @@ void UUxtManipulatorComponentBase::OnManipulationStarted(UUxtGrabTargetComponent
 	{
 		UpdateManipulationLogic(NumGrabPointers);
 	}
+
+	if (NumGrabPointers == 1)
+	{
+		LocationFilter.Reset();
+		RotationFilter.Reset();
+	}
 }
 
 void UUxtManipulatorComponentBase::OnManipulationEnd(UUxtGrabTargetComponent* Grabbable, FUxtGrabPointerData GrabPointer)
@@ -12,6 +12,7 @@
 #include "Engine/Selection.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/World.h"
+#include "Input/UxtInputSubsystem.h"
 #include "Tooltips/UxtTooltipActor.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Utils/UxtFunctionLibrary.h"
@@ -33,6 +34,18 @@ void UUxtTooltipSpawnerComponent::EndPlay(const EEndPlayReason::Type EndPlayReas
 	Super::EndPlay(EndPlayReason);
 }
 
+void UUxtTooltipSpawnerComponent::OnRegister()
+{
+	Super::OnRegister();
+	UUxtInputSubsystem::RegisterInterfaceComponent(this);
+}
+
+void UUxtTooltipSpawnerComponent::OnUnregister()
+{
+	UUxtInputSubsystem::UnregisterInterfaceComponent(this);
+	Super::OnUnregister();
+}
+
 void UUxtTooltipSpawnerComponent::OnComponentCreated()
 {
 	Super::OnComponentCreated();
@@ -0,0 +1,33 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Utils/UxtAsyncLineTrace.h"
+
+#include "Engine/World.h"
+
+bool FUxtAsyncLineTrace::Trace(
+	UWorld* World, FHitResult& OutHit, const FVector& Start, const FVector& End, ECollisionChannel TraceChannel,
+	const FCollisionQueryParams& QueryParams)
+{
+	PendingTrace.Invalidate();
+	return World->LineTraceSingleByChannel(OutHit, Start, End, TraceChannel, QueryParams);
+}
+
+bool FUxtAsyncLineTrace::TraceAsync(
+	UWorld* World, FHitResult& OutHit, const FVector& Start, const FVector& End, const FVector& QueueStart, const FVector& QueueEnd,
+	ECollisionChannel TraceChannel, const FCollisionQueryParams& QueryParams)
+{
+	// Results are only kept for one frame, so this fails if the trace was queued earlier than the previous frame
+	FTraceDatum Datum;
+	const bool bHasQueuedResult = PendingTrace.IsValid() && World->QueryTraceData(PendingTrace, Datum);
+
+	PendingTrace = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, QueueStart, QueueEnd, TraceChannel, QueryParams);
+
+	if (!bHasQueuedResult)
+	{
+		return World->LineTraceSingleByChannel(OutHit, Start, End, TraceChannel, QueryParams);
+	}
+
+	OutHit = Datum.OutHits.Num() > 0 ? Datum.OutHits[0] : FHitResult(QueueStart, QueueEnd);
+	return OutHit.bBlockingHit;
+}
@@ -4,9 +4,11 @@
 #include "Utils/UxtFunctionLibrary.h"
 
 #include "AudioDevice.h"
-#include "HeadMountedDisplayFunctionLibrary.h"
 
+#include "Engine/Engine.h"
+#include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
+#include "Utils/UxtHeadPoseSubsystem.h"
 #if WITH_EDITOR
 #include "Editor/EditorEngine.h"
 #endif
@@ -16,22 +18,25 @@ FTransform UUxtFunctionLibrary::TestHeadPose = FTransform::Identity;
 
 FTransform UUxtFunctionLibrary::GetHeadPose(UObject* WorldContextObject)
 {
-	if (bUseTestData)
+	UUxtHeadPoseSubsystem* HeadPoseSubsystem = nullptr;
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull))
 	{
-		return TestHeadPose;
+		HeadPoseSubsystem = World->GetSubsystem<UUxtHeadPoseSubsystem>();
 	}
 
-	FRotator Rotation;
-	FVector Position;
-	UHeadMountedDisplayFunctionLibrary::GetOrientationAndPosition(Rotation, Position);
-
-	FTransform TrackingSpaceTransform(Rotation, Position);
-	FTransform TrackingToWorld = UHeadMountedDisplayFunctionLibrary::GetTrackingToWorldTransform(WorldContextObject);
+	// Head pose overrides, e.g. from a replayed recording, take precedence over test data
+	if (bUseTestData && !(HeadPoseSubsystem && HeadPoseSubsystem->HasHeadPoseOverride()))
+	{
+		return TestHeadPose;
+	}
 
-	FTransform Result;
-	FTransform::Multiply(&Result, &TrackingSpaceTransform, &TrackingToWorld);
+	// Read the pose sampled once per frame by the world's head pose subsystem, the XR system is only queried directly without a world
+	if (HeadPoseSubsystem)
+	{
+		return HeadPoseSubsystem->GetHeadPose();
+	}
 
-	return Result;
+	return UUxtHeadPoseSubsystem::QueryHeadPose(WorldContextObject);
 }
 
 bool UUxtFunctionLibrary::IsInEditor()
@@ -0,0 +1,145 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Utils/UxtHeadPoseSubsystem.h"
+
+#include "HeadMountedDisplayFunctionLibrary.h"
+
+#include "Engine/World.h"
+#include "Utils/UxtFunctionLibrary.h"
+
+void UUxtHeadPoseSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	TickDelegateHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &UUxtHeadPoseSubsystem::OnWorldPreActorTick);
+}
+
+void UUxtHeadPoseSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPreActorTick.Remove(TickDelegateHandle);
+	TickDelegateHandle.Reset();
+}
+
+FTransform UUxtHeadPoseSubsystem::GetHeadPose()
+{
+	UpdateHeadPose();
+	return HeadPose;
+}
+
+FVector UUxtHeadPoseSubsystem::GetLinearVelocity()
+{
+	UpdateHeadPose();
+	return LinearVelocity;
+}
+
+FVector UUxtHeadPoseSubsystem::GetAngularVelocity()
+{
+	UpdateHeadPose();
+	return AngularVelocity;
+}
+
+void UUxtHeadPoseSubsystem::SetHeadPoseOverride(const FTransform& Pose)
+{
+	HeadPoseOverride = Pose;
+
+	// Replace this frame's sample rather than waiting for the next frame
+	if (FrameId == GFrameCounter)
+	{
+		SampleHeadPose();
+	}
+}
+
+void UUxtHeadPoseSubsystem::ClearHeadPoseOverride()
+{
+	if (!HeadPoseOverride.IsSet())
+	{
+		return;
+	}
+
+	HeadPoseOverride.Reset();
+
+	if (FrameId == GFrameCounter)
+	{
+		SampleHeadPose();
+	}
+}
+
+bool UUxtHeadPoseSubsystem::HasHeadPoseOverride() const
+{
+	return HeadPoseOverride.IsSet();
+}
+
+uint64 UUxtHeadPoseSubsystem::GetFrameId() const
+{
+	return FrameId;
+}
+
+void UUxtHeadPoseSubsystem::UpdateHeadPose()
+{
+	if (FrameId != GFrameCounter)
+	{
+		SampleHeadPose();
+	}
+}
+
+void UUxtHeadPoseSubsystem::SampleHeadPose()
+{
+	UWorld* World = GetWorld();
+
+	FTransform NewHeadPose;
+	if (HeadPoseOverride.IsSet())
+	{
+		NewHeadPose = HeadPoseOverride.GetValue();
+	}
+	else
+	{
+		NewHeadPose = UUxtFunctionLibrary::bUseTestData ? UUxtFunctionLibrary::TestHeadPose : QueryHeadPose(World);
+	}
+
+	// Real time keeps advancing while the game is paused, when the head can still move
+	const float NewSampleTime = World ? World->GetRealTimeSeconds() : 0.0f;
+	const float DeltaTime = NewSampleTime - SampleTime;
+
+	if (FrameId == static_cast<uint64>(INDEX_NONE))
+	{
+		LinearVelocity = FVector::ZeroVector;
+		AngularVelocity = FVector::ZeroVector;
+	}
+	else if (DeltaTime > KINDA_SMALL_NUMBER)
+	{
+		LinearVelocity = (NewHeadPose.GetLocation() - HeadPose.GetLocation()) / DeltaTime;
+
+		FQuat DeltaRotation = NewHeadPose.GetRotation() * HeadPose.GetRotation().Inverse();
+		DeltaRotation.EnforceShortestArcWith(FQuat::Identity);
+		FVector Axis;
+		float Angle;
+		DeltaRotation.ToAxisAndAngle(Axis, Angle);
+		AngularVelocity = Axis * (Angle / DeltaTime);
+	}
+
+	HeadPose = NewHeadPose;
+	SampleTime = NewSampleTime;
+	FrameId = GFrameCounter;
+}
+
+FTransform UUxtHeadPoseSubsystem::QueryHeadPose(UObject* WorldContextObject)
+{
+	FRotator Rotation;
+	FVector Position;
+	UHeadMountedDisplayFunctionLibrary::GetOrientationAndPosition(Rotation, Position);
+
+	FTransform TrackingSpaceTransform(Rotation, Position);
+	FTransform TrackingToWorld = UHeadMountedDisplayFunctionLibrary::GetTrackingToWorldTransform(WorldContextObject);
+
+	FTransform Result;
+	FTransform::Multiply(&Result, &TrackingSpaceTransform, &TrackingToWorld);
+
+	return Result;
+}
+
+void UUxtHeadPoseSubsystem::OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaTime)
+{
+	if (World == GetWorld())
+	{
+		UpdateHeadPose();
+	}
+}
@@ -0,0 +1,107 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Utils/UxtOneEuroFilter.h"
+
+void FUxtOneEuroFilter::Reset()
+{
+	Value = 0.0f;
+	Speed = 0.0f;
+	bHasValue = false;
+}
+
+void FUxtOneEuroFilter::Reset(float InitialValue)
+{
+	Value = InitialValue;
+	Speed = 0.0f;
+	bHasValue = true;
+}
+
+float FUxtOneEuroFilter::Filter(float Sample, float DeltaTime, const FUxtOneEuroFilterSettings& Settings)
+{
+	if (!bHasValue)
+	{
+		Reset(Sample);
+		return Value;
+	}
+
+	if (DeltaTime <= 0.0f)
+	{
+		return Value;
+	}
+
+	// Speed is estimated from the filtered value to keep sensor noise out of the cutoff
+	const float RawSpeed = (Sample - Value) / DeltaTime;
+	Speed = FMath::Lerp(Speed, RawSpeed, GetSmoothingFactor(Settings.DerivativeCutoff, DeltaTime));
+
+	const float Cutoff = Settings.MinCutoff + Settings.Beta * FMath::Abs(Speed);
+	Value = FMath::Lerp(Value, Sample, GetSmoothingFactor(Cutoff, DeltaTime));
+	return Value;
+}
+
+float FUxtOneEuroFilter::GetSmoothingFactor(float Cutoff, float DeltaTime)
+{
+	const float TimeConstant = 1.0f / (2.0f * PI * FMath::Max(Cutoff, KINDA_SMALL_NUMBER));
+	return 1.0f / (1.0f + TimeConstant / DeltaTime);
+}
+
+void FUxtOneEuroVectorFilter::Reset()
+{
+	for (FUxtOneEuroFilter& AxisFilter : AxisFilters)
+	{
+		AxisFilter.Reset();
+	}
+}
+
+void FUxtOneEuroVectorFilter::Reset(const FVector& InitialValue)
+{
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		AxisFilters[Axis].Reset(InitialValue[Axis]);
+	}
+}
+
+FVector FUxtOneEuroVectorFilter::Filter(const FVector& Sample, float DeltaTime, const FUxtOneEuroFilterSettings& Settings)
+{
+	return FVector(
+		AxisFilters[0].Filter(Sample.X, DeltaTime, Settings), AxisFilters[1].Filter(Sample.Y, DeltaTime, Settings),
+		AxisFilters[2].Filter(Sample.Z, DeltaTime, Settings));
+}
+
+void FUxtOneEuroQuatFilter::Reset()
+{
+	Value = FQuat::Identity;
+	AngularSpeed = 0.0f;
+	bHasValue = false;
+}
+
+void FUxtOneEuroQuatFilter::Reset(const FQuat& InitialValue)
+{
+	Value = InitialValue.GetNormalized();
+	AngularSpeed = 0.0f;
+	bHasValue = true;
+}
+
+FQuat FUxtOneEuroQuatFilter::Filter(const FQuat& Sample, float DeltaTime, const FUxtOneEuroFilterSettings& Settings)
+{
+	if (!bHasValue)
+	{
+		Reset(Sample);
+		return Value;
+	}
+
+	if (DeltaTime <= 0.0f)
+	{
+		return Value;
+	}
+
+	FQuat Target = Sample.GetNormalized();
+	Target.EnforceShortestArcWith(Value);
+
+	const float RawAngularSpeed = Value.AngularDistance(Target) / DeltaTime;
+	AngularSpeed = FMath::Lerp(AngularSpeed, RawAngularSpeed, FUxtOneEuroFilter::GetSmoothingFactor(Settings.DerivativeCutoff, DeltaTime));
+
+	const float Cutoff = Settings.MinCutoff + Settings.Beta * AngularSpeed;
+	Value = FQuat::Slerp(Value, Target, FUxtOneEuroFilter::GetSmoothingFactor(Cutoff, DeltaTime));
+	return Value;
+}
@@ -9,6 +9,7 @@
 #include "Interactions/UxtFarHandler.h"
 #include "Interactions/UxtFarTarget.h"
 #include "UObject/WeakObjectPtrTemplates.h"
+#include "Utils/UxtAsyncLineTrace.h"
 
 #include "UxtTapToPlaceComponent.generated.h"
 
@@ -81,6 +82,8 @@ protected:
 	//
 	// UActorComponent interface
 	virtual void BeginPlay() override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
@@ -178,4 +181,7 @@ private:
 
 	/** Far pointer that initiated placement, if any. */
 	TWeakObjectPtr<UUxtFarPointerComponent> FocusLockedPointerWeak;
+
+	/** Placement trace, queued asynchronously when placing with a far pointer that uses async traces. */
+	FUxtAsyncLineTrace PlacementTrace;
 };
@@ -13,6 +13,8 @@
 //
 // Delegates
 DECLARE_DYNAMIC_DELEGATE_RetVal_TwoParams(bool, FUxtSortScrollingObjectCollectionDelegate, const AActor*, LHS, const AActor*, RHS);
+DECLARE_DYNAMIC_DELEGATE_RetVal_OneParam(float, FUxtObjectCollectionFloatSortKeyDelegate, const AActor*, Actor);
+DECLARE_DYNAMIC_DELEGATE_RetVal_OneParam(FString, FUxtObjectCollectionStringSortKeyDelegate, const AActor*, Actor);
 
 /**
  * Base scene component class for object collections
@@ -27,7 +29,21 @@ public:
 	 *	In order to see results of sorting with the editor it is necessary to enable run in editor in the functions details panel.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Uxt Base Object Collection - Experimental", meta = (AutoCreateRefTerm = "Callback"))
-	void SetSortCallback(const FUxtSortScrollingObjectCollectionDelegate& Callback) { SortCollection = Callback; }
+	void SetSortCallback(const FUxtSortScrollingObjectCollectionDelegate& Callback);
+
+	/** Sort the attached actors in ascending order of a number returned by the callback for each actor.
+	 *	Keys are requested once per actor and the sorted order is kept until actors are added to the collection. Set the callback again to
+	 *	sort with updated keys. Clears any other sort callback.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Base Object Collection - Experimental", meta = (AutoCreateRefTerm = "Callback"))
+	void SetFloatSortKeyCallback(const FUxtObjectCollectionFloatSortKeyDelegate& Callback);
+
+	/** Sort the attached actors in ascending lexical order of a string returned by the callback for each actor.
+	 *	Keys are requested once per actor and the sorted order is kept until actors are added to the collection. Set the callback again to
+	 *	sort with updated keys. Clears any other sort callback.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Base Object Collection - Experimental", meta = (AutoCreateRefTerm = "Callback"))
+	void SetStringSortKeyCallback(const FUxtObjectCollectionStringSortKeyDelegate& Callback);
 
 	//
 	//  Events
@@ -50,12 +66,41 @@ protected:
 	/** Collect array of actors that are currently attached to the actor that this component is a part of. */
 	const TArray<AActor*>& CollectAttachedActors();
 
+	/** Add a single actor to the end of the array of attached actors, without collecting or sorting the others. */
+	void AppendAttachedActor(AActor* Actor);
+
+	/** Incremented whenever the order of the attached actors may have changed, other than by appending actors. */
+	int32 GetSortRevision() const { return SortRevision; }
+
+	/** True if any sort callback is set, in which case new actors are not necessarily placed at the end of the collection. */
+	bool IsSorted() const;
+
 private:
+	/** Add the components of the actor that implement the IUxtCollectionObject interface. */
+	void AddCollectionObjectInterfaceComponents(const AActor* Actor);
+
+	/** Unbind all sort callbacks and make sure that the next collection sorts again. */
+	void ResetSortCallbacks();
+
+	/** Callback returning the numeric sort key of an actor. */
+	UPROPERTY()
+	FUxtObjectCollectionFloatSortKeyDelegate FloatSortKey;
+
+	/** Callback returning the string sort key of an actor. */
+	UPROPERTY()
+	FUxtObjectCollectionStringSortKeyDelegate StringSortKey;
+
+	/** Number of attached actors when they were last sorted by key, INDEX_NONE if they need to be sorted again. */
+	int32 NumActorsSortedByKey = INDEX_NONE;
+
 	/** Array of actors attached to this collection. */
 	TArray<AActor*> AttachedActors;
 
 	/** Up to date list of components in the collection that implement the IUxtCollectionObject interface. */
 	TArray<UActorComponent*> CollectionObjectInterfaceComponents;
+
+	/** See #GetSortRevision. */
+	int32 SortRevision = 0;
 };
 
 inline const TArray<AActor*>& UUxtBaseObjectCollection::GetAttachedActors() const
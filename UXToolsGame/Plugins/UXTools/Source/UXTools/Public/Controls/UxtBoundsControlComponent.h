@@ -19,6 +19,8 @@ class UMaterialInstanceDynamic;
 class UPrimitiveComponent;
 class UStaticMesh;
 class UBoxComponent;
+class UInstancedStaticMeshComponent;
+class UMaterialInterface;
 struct UxtAffordanceInteractionCache;
 
 /** Instance of an affordance on the bounds control actor. */
@@ -48,6 +50,26 @@ struct FUxtAffordanceInstance
 
 	/** Reference scale to be used during scaling animations */
 	FVector ReferenceRelativeScale = FVector::OneVector;
+
+	/** Index in the instanced mesh of the affordance kind, INDEX_NONE if affordances are not rendered as instances. */
+	int32 RenderInstanceIndex = INDEX_NONE;
+};
+
+/** State of a component in the bounds hierarchy when the bounds were last computed. */
+struct FUxtBoundsSourceEntry
+{
+	TWeakObjectPtr<const USceneComponent> Component;
+
+	/** Transform relative to the parent, identity for the bounds root. */
+	FTransform RelativeTransform;
+
+	/** Mesh asset of the component, if any. */
+	TWeakObjectPtr<const UObject> Mesh;
+
+	/** Radius of the world space bounds, changes with the mesh or shape of the primitive but not with its location or rotation. */
+	float BoundsRadius = 0.0f;
+
+	bool bIsRegistered = false;
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(
@@ -66,6 +88,8 @@ class UXTOOLS_API UUxtBoundsControlComponent : public UUxtManipulatorComponent
 {
 	GENERATED_BODY()
 
+	friend class UUxtBoundsControlSubsystem;
+
 public:
 	UUxtBoundsControlComponent();
 
@@ -117,6 +141,23 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Bounds Control|Affordances")
 	UStaticMesh* CornerAffordanceMesh;
 
+	/**
+	 * Render all affordances of the same kind with a single instanced static mesh component.
+	 * Opacity, focus and active transitions are passed as per-instance custom data (in this order) instead of material parameters,
+	 * so the affordance material must read them using PerInstanceCustomData. Affordance primitives are kept for collision only.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Uxt Bounds Control|Affordances", AdvancedDisplay)
+	bool bUseInstancedAffordanceRendering = false;
+
+	/**
+	 * Material used for instanced affordances, must read opacity, focus and active transitions from PerInstanceCustomData.
+	 * Affordances are rendered individually with the material of the affordance mesh if not set.
+	 */
+	UPROPERTY(
+		EditAnywhere, Category = "Uxt Bounds Control|Affordances", AdvancedDisplay,
+		meta = (EditCondition = "bUseInstancedAffordanceRendering"))
+	UMaterialInterface* InstancedAffordanceMaterial;
+
 	/** Collision box that prevents pointer rays from passing through bounds control's box. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Bounds Control")
 	UBoxComponent* CollisionBox;
@@ -125,6 +166,30 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Bounds Control", AdvancedDisplay)
 	FName CollisionProfile = TEXT("UI");
 
+	/**
+	 * Only recompute the bounds when the component hierarchy, a child transform or a mesh has changed.
+	 * Moving the actor then only updates the affordance transforms. Disable this if the bounds depend on state that is not tracked,
+	 * e.g. a mesh deforming without a change of its bounds radius.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Bounds Control", AdvancedDisplay)
+	bool bIncrementalBoundsUpdate = true;
+
+	/**
+	 * Let the bounds control subsystem disable ticking while no pointer is near, no affordance is visible or animating
+	 * and the actor is not moving. Changes to the components below the bounds root are picked up once the bounds control wakes up.
+	 * Ticking is never re-enabled if it was disabled by other means.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Bounds Control", AdvancedDisplay)
+	bool bSleepWhenIdle = true;
+
+	/**
+	 * Create the affordance actor only when a pointer comes within reach of the bounds control for the first time.
+	 * Until then @ref GetBoundsControlActor returns null and no affordance primitives exist.
+	 * Disabled by default since callers may expect the affordance actor to exist once the bounds control is registered.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Uxt Bounds Control|Affordances", AdvancedDisplay)
+	bool bDeferAffordanceCreation = false;
+
 	/** Hand distance at which affordances become visible. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Bounds Control")
 	float AffordanceVisibilityDistance = 10.f;
@@ -189,6 +254,9 @@ protected:
 	/** Update the world transforms of affordance actors to match the current bounding box. */
 	void UpdateAffordanceTransforms();
 
+	/** True if bounds or transforms have changed since the last affordance transform update. */
+	bool NeedsAffordanceTransformUpdate() const;
+
 	/** Update animated properties such as affordance highlights. */
 	void UpdateAffordanceAnimation(float DeltaTime);
 
@@ -205,6 +273,27 @@ private:
 	/** Setup the @ref CollisionBox component. */
 	void CreateCollisionBox();
 
+	/** True if the bounds control does not need to tick until a pointer comes near. */
+	bool CanSleep() const;
+
+	/** Enable or disable ticking. Only re-enables ticking that was disabled by going to sleep. */
+	void SetAwake(bool bAwake);
+
+	/** Create affordances if their creation was deferred and has not been attempted yet. */
+	void CreateDeferredAffordances();
+
+	/** Get the instanced mesh used for rendering affordances of the given kind, creating it if needed. */
+	UInstancedStaticMeshComponent* GetOrCreateAffordanceInstancedMesh(EUxtAffordanceKind Kind);
+
+	/** Component whose hierarchy is used for the bounds. */
+	const USceneComponent* GetBoundsTargetComponent() const;
+
+	/**
+	 * Compare the bounds hierarchy with the state recorded at the last call and record the new state.
+	 * Returns true if anything affecting the local bounds has changed.
+	 */
+	bool UpdateBoundsSourceState(const USceneComponent* BoundsTargetComponent);
+
 	/**
 	 * Resets the Transform that the @ref ConstraintsManager uses as reference.
 	 *
@@ -249,6 +338,10 @@ private:
 	UPROPERTY(Transient)
 	TMap<UPrimitiveComponent*, FUxtAffordanceInstance> PrimitiveAffordanceMap;
 
+	/** Instanced meshes rendering the affordances of each kind when @ref bUseInstancedAffordanceRendering is enabled. */
+	UPROPERTY(Transient, DuplicateTransient)
+	TMap<EUxtAffordanceKind, UInstancedStaticMeshComponent*> AffordanceInstancedMeshes;
+
 	/**
 	 * Contains the currently active affordances being moved by grab pointers.
 	 *
@@ -260,4 +353,25 @@ private:
 
 	/** Cache that holds certain data that is relevant during the whole interaction with an affordance. */
 	TUniquePtr<UxtAffordanceInteractionCache> InteractionCache;
+
+	/** Recorded bounds hierarchy state for incremental bounds updates. */
+	TArray<FUxtBoundsSourceEntry> BoundsSourceState;
+
+	/** True if any affordance was visible after the last animation update. */
+	bool bAnyAffordanceVisible = false;
+
+	/** True if the bounds hierarchy changed during the last tick. */
+	bool bBoundsSourceChanged = false;
+
+	/** True while ticking is disabled by @ref SetAwake. */
+	bool bIsSleeping = false;
+
+	/** Set when affordances could not be created, so that deferred creation is not attempted again. */
+	bool bAffordanceCreationFailed = false;
+
+	/** Inputs of the last affordance transform update. */
+	bool bAffordanceTransformsValid = false;
+	FBox AffordanceBounds = FBox(ForceInit);
+	FTransform AffordanceTargetTransform;
+	FTransform AffordanceOwnerTransform;
 };
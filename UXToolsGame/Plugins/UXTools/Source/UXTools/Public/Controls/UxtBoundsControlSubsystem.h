@@ -0,0 +1,87 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+
+#include "UxtBoundsControlSubsystem.generated.h"
+
+class UUxtBoundsControlComponent;
+class UMaterialParameterCollection;
+
+/**
+ * World subsystem that keeps track of all bounds controls in the world.
+ *
+ * Bounds controls are only ticked while a pointer is within reach of their affordances, while they are being interacted with,
+ * or while their affordances need to follow a moved actor. Proximity of all bounds controls to the pointers is tested in a single
+ * pass over packed bounding spheres once per frame. The finer per-affordance visibility test then only runs in the tick of the
+ * bounds controls that are awake.
+ */
+UCLASS(ClassGroup = "UXTools")
+class UXTOOLS_API UUxtBoundsControlSubsystem
+	: public UWorldSubsystem
+	, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	UUxtBoundsControlSubsystem();
+
+	//
+	// USubsystem interface
+
+	virtual void Deinitialize() override;
+
+	//
+	// FTickableGameObject interface
+
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+
+	/** Start managing the tick of the bounds control. */
+	void RegisterBoundsControl(UUxtBoundsControlComponent* BoundsControl);
+
+	/** Stop managing the tick of the bounds control. */
+	void UnregisterBoundsControl(UUxtBoundsControlComponent* BoundsControl);
+
+	/** Number of bounds controls registered with the subsystem. */
+	int32 GetNumBoundsControls() const;
+
+	/** Number of bounds controls that were ticking after the last update. */
+	int32 GetNumAwakeBoundsControls() const;
+
+private:
+	/** Copy the world space bounding spheres of all bounds controls into the packed arrays, dropping destroyed ones. */
+	void GatherBoundingSpheres();
+
+	/** Flag all bounds controls with a pointer inside their wake radius. */
+	void TestPointerProximity(const FVector* PointerPositions, int32 NumPointers);
+
+	/** Registered bounds controls. */
+	UPROPERTY(Transient)
+	TArray<UUxtBoundsControlComponent*> BoundsControls;
+
+	/** Parameter collection containing the pointer positions. */
+	UPROPERTY(Transient)
+	UMaterialParameterCollection* ParameterCollection;
+
+	/** Bounding sphere centers of the bounds controls, in the same order as BoundsControls. */
+	TArray<float> CentersX;
+	TArray<float> CentersY;
+	TArray<float> CentersZ;
+
+	/** Squared distance from a sphere center within which a pointer wakes up the bounds control. */
+	TArray<float> WakeRadiiSquared;
+
+	/** Result of the proximity test, non-zero if a pointer is near the bounds control. */
+	TArray<uint8> IsNearPointer;
+
+	int32 NumAwakeBoundsControls = 0;
+};
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 
 #include "Controls/UxtRingCursorComponent.h"
+#include "Utils/UxtOneEuroFilter.h"
 
 #include "UxtFingerCursorComponent.generated.h"
 
@@ -31,6 +32,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Finger Cursor")
 	bool bShowOnGrabTargets = false;
 
+	/** Smooth the cursor transform with an adaptive filter to remove finger jitter while keeping fast movements responsive. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Finger Cursor", AdvancedDisplay)
+	bool bFilterCursorTransform = false;
+
+	/** Filter settings for the cursor location, speed is measured in units per second. */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Uxt Finger Cursor", AdvancedDisplay,
+		meta = (EditCondition = "bFilterCursorTransform"))
+	FUxtOneEuroFilterSettings LocationFilterSettings = FUxtOneEuroFilterSettings(2.0f, 0.1f, 1.0f);
+
+	/** Filter settings for the cursor rotation, speed is measured in radians per second. */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Uxt Finger Cursor", AdvancedDisplay,
+		meta = (EditCondition = "bFilterCursorTransform"))
+	FUxtOneEuroFilterSettings RotationFilterSettings = FUxtOneEuroFilterSettings(2.0f, 0.5f, 1.0f);
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -49,4 +66,8 @@ private:
 
 	/** Scaler applied to the Proximity Distance to fade the cursor in when enabled. */
 	float CursorFadeScaler;
+
+	/** Filter state used when bFilterCursorTransform is set. */
+	FUxtOneEuroVectorFilter LocationFilter;
+	FUxtOneEuroQuatFilter RotationFilter;
 };
@@ -70,10 +70,34 @@ struct FScrollingCollectionProperties
 	float Height;
 };
 
+/** Properties that the placement of the attached actors depends on. */
+struct FUxtScrollingCollectionLayout
+{
+	int32 Tiers = 0;
+	float CellWidth = 0.0f;
+	float CellHeight = 0.0f;
+	EUxtScrollDirection ScrollDirection = EUxtScrollDirection::UpAndDown;
+
+	/** Number of actors placed, INDEX_NONE if the layout has not been computed. */
+	int32 NumItems = INDEX_NONE;
+
+	/** Sort revision of the attached actors when they were placed. */
+	int32 SortRevision = 0;
+
+	bool operator==(const FUxtScrollingCollectionLayout& Other) const
+	{
+		return Tiers == Other.Tiers && CellWidth == Other.CellWidth && CellHeight == Other.CellHeight &&
+			   ScrollDirection == Other.ScrollDirection && NumItems == Other.NumItems && SortRevision == Other.SortRevision;
+	}
+	bool operator!=(const FUxtScrollingCollectionLayout& Other) const { return !(*this == Other); }
+};
+
 //
 // Delegates
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FUxtScrollingObjectCollectionUpdated, FScrollingCollectionProperties const&, Properties);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FUxtScrollingObjectCollectionOnPaginationEnd, EUxtPaginateResult, Result);
+DECLARE_DYNAMIC_DELEGATE_RetVal(int32, FUxtScrollingObjectCollectionGetItemCount);
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FUxtScrollingObjectCollectionBindItem, int32, ItemIndex, AActor*, ItemActor);
 
 /**
  * Component that adds a scrollable object menu to the actor to which it is attached
@@ -105,6 +129,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Uxt Scrolling Object Collection - Experimental")
 	void AddActorToCollection(AActor* ActorToAdd);
 
+	/**
+	 * Populate the collection from a data source instead of attached actors.
+	 * Only the items within the viewable area and #VirtualizationMargin are bound to actors of ItemClass. Actors are pooled and
+	 * rebound to other items as the collection scrolls, so the number of live actors depends on the viewable area, not the item count.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Scrolling Object Collection - Experimental")
+	void SetDataSource(
+		TSubclassOf<AActor> ItemClass, const FUxtScrollingObjectCollectionGetItemCount& GetItemCount,
+		const FUxtScrollingObjectCollectionBindItem& BindItem);
+
+	/** Query the item count from the data source again and rebind all items in view. */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Scrolling Object Collection - Experimental")
+	void RefreshDataSource();
+
+	/** Returns true if the collection is populated from a data source. */
+	UFUNCTION(BlueprintPure, Category = "Uxt Scrolling Object Collection - Experimental")
+	bool IsVirtualized() const { return VirtualItemClass != nullptr; }
+
+	/** Get the actor currently representing the item, or null if the item is not in view. */
+	UFUNCTION(BlueprintPure, Category = "Uxt Scrolling Object Collection - Experimental")
+	AActor* GetItemActor(int32 ItemIndex) const;
+
 	/** Return current scroll direction */
 	UFUNCTION(BlueprintCallable, Category = "Uxt Scrolling Object Collection - Experimental", meta = (AutoCreateRefTerm = "Callback"))
 	EUxtScrollDirection GetScrollDirection();
@@ -133,6 +179,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Uxt Scrolling Object Collection - Experimental")
 	int32 ViewableArea;
 
+	/** Number of lines outside of the viewable area that keep their actors bound when using a data source. */
+	UPROPERTY(EditAnywhere, Category = "Uxt Scrolling Object Collection - Experimental", meta = (UIMin = "0"))
+	int32 VirtualizationMargin;
+
 	/** Collision profile used by the box collider */
 	UPROPERTY(EditAnywhere, Category = "Uxt Scrolling Object Collection - Experimental")
 	FName CollisionProfile;
@@ -148,7 +198,7 @@ public:
 
 	/** Velocity damping factor.
 	 * For no velocity to be retained set this value to 1.0.
-	 * Note: This is currently applied per frame and is frame rate dependent, WIP to adjust for frame rate. */
+	 * Note: This is applied once per #ScrollTimeStep. */
 	UPROPERTY(EditAnywhere, Category = "Uxt Scrolling Object Collection - Experimental", meta = (UIMin = "0.0", UIMax = "1.0"))
 	float VelocityDamping;
 
@@ -168,6 +218,11 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Uxt Scrolling Object Collection - Experimental", meta = (UIMin = "0.0", UIMax = "1.0"))
 	float SnapToStrength;
 
+	/** Time step used to integrate velocity, bounce and snap while the collection is not interacted with.
+	 *	The motion is the same regardless of frame rate, and the collection stops ticking once it comes to rest. */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Uxt Scrolling Object Collection - Experimental", meta = (ClampMin = "0.001"))
+	float ScrollTimeStep;
+
 	/** If the interaction ends before moving this far it will be considered a click. */
 	UPROPERTY(EditAnywhere, Category = "Uxt Scrolling Object Collection - Experimental", meta = (UIMin = "0.0"))
 	float ClickMovementThreshold;
@@ -180,13 +235,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Uxt Scrolling Object Collection - Experimental")
 	void SetBackPlate(UUxtBackPlateComponent* Plate) { BackPlate = Plate; }
 
+	/** Get the current offset of the collection along the scroll direction. */
+	UFUNCTION(BlueprintPure, Category = "Uxt Scrolling Object Collection - Experimental")
+	float GetScrollOffset() const { return GetCurrentNetOffset(); }
+
+	/** True if the collection is at rest and has stopped ticking until the next interaction, pagination or change to its items. */
+	UFUNCTION(BlueprintPure, Category = "Uxt Scrolling Object Collection - Experimental")
+	bool IsSettled() const { return bIsSettled; }
+
 protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	// Called when the component is registered, adds it to the input subsystem's interface components
+	virtual void OnRegister() override;
+
+	// Called when the component is unregistered
+	virtual void OnUnregister() override;
+
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	// Called when the game ends
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Called when component is destroyed
 	virtual void DestroyComponent(bool bPromoteToChildred) override;
 
@@ -216,15 +288,51 @@ protected:
 	virtual void OnFarReleased_Implementation(UUxtFarPointerComponent* Pointer) override;
 
 private:
-	/** Called to reset the visibility of all attached actors based on current collection state. */
+	/**
+	 * Called to update the visibility of attached actors based on current collection state.
+	 * Only actors entering or leaving the visible range since the last call are updated, unless the range has been invalidated.
+	 */
 	void ResetCollectionVisibility();
 
-	/** Called to update the collection based on the current properties. */
+	/** Show or hide an item actor, including its tick and collision. */
+	void SetItemActorHidden(AActor* Actor, bool bHidden) const;
+
+	/**
+	 * Called to update the collection based on the current properties.
+	 * Attached actors are only placed again if the layout they depend on has changed.
+	 */
 	void InitializeCollection();
 
+	/** Layout of the attached actors for the current properties. */
+	FUxtScrollingCollectionLayout GetCurrentLayout() const;
+
+	/** Place an actor at the end of a collection that has already been laid out, without moving the other actors. */
+	void AppendActorToCollection(AActor* Actor);
+
+	/** Bind actors to the data source items in the given range plus the margin, releasing actors of items outside of it. */
+	void UpdateVirtualItems(int32 FirstVisible, int32 FirstNotVisible);
+
+	/** Get an actor from the pool or spawn a new one. */
+	AActor* AcquireVirtualItemActor();
+
+	/** Hide an actor and return it to the pool. */
+	void ReleaseVirtualItemActor(AActor* Actor);
+
+	/** Release all actors bound to data source items. */
+	void ReleaseAllVirtualItems();
+
+	/** Location of the item in the collection root space. */
+	FVector GetItemRelativeLocation(int32 ItemIndex) const;
+
+	/** Number of items in the collection, either attached actors or data source items. */
+	int32 GetNumberOfItemsInCollection() const;
+
 	/** Called to configure the box component based on the collection's properties. */
 	void ConfigureBoxComponent();
 
+	/** Fit the box component to the cached collision bounds. */
+	void UpdateBoxComponentBounds();
+
 	/** Helper function to transform a world space location to local space. */
 	FVector LocationWorldToLocal(const FVector WorldSpaceLocation) const;
 
@@ -237,6 +345,18 @@ private:
 	/** Tick the Collection Offset */
 	void TickCollectionOffset(const float DeltaTime);
 
+	/** Integrate bounce, snap and damping of the offset over a single fixed time step. */
+	void StepScrollPhysics(const float TimeStep);
+
+	/** Get the offset of the cell boundary nearest to the current offset. */
+	float GetNearestSnapOffset() const;
+
+	/** True if the offset will not change until the next interaction, pagination or change to the collection. */
+	bool HasSettled() const;
+
+	/** Enable ticking of a settled collection. */
+	void WakeUp();
+
 	/** Calculate the number of rows in the collection given current properties. */
 	int GetNumberOfRowsInCollection() const;
 
@@ -297,6 +417,15 @@ private:
 	/** Cached extent from the last time the BoxComponent's extents were calculated. Used for #bReleaseAtScrollBoundary workaround. */
 	FVector BoxComponentExtents;
 
+	/** Local space bounds of the items with collision enabled, before the box component's front face is expanded. */
+	FBox CollisionBounds;
+
+	/** False if #CollisionBounds need to be calculated from the items again. */
+	bool bCollisionBoundsValid;
+
+	/** Layout the attached actors were last placed with. */
+	FUxtScrollingCollectionLayout Layout;
+
 	/** Actor used to organize attached actors and make movement easier. Created in BeginPlay */
 	USceneComponent* CollectionRoot;
 
@@ -333,6 +462,15 @@ private:
 	/** Pagination complete delegate. */
 	FUxtScrollingObjectCollectionOnPaginationEnd OnPaginationComplete;
 
+	/** Time not yet integrated by #StepScrollPhysics. */
+	float ScrollTimeAccumulator;
+
+	/** Net offset last applied to the collection root. */
+	float AppliedNetOffset;
+
+	/** Set when the collection has come to rest and disabled its tick. */
+	bool bIsSettled;
+
 	/** Has hit the #ClickMovementThreshold */
 	bool bHasHitClickMovementThreshold;
 
@@ -341,6 +479,43 @@ private:
 	/** Handle for the callback to check if we are scrolling or clicking */
 	FTimerHandle ScrollOrClickHandle;
 
+	/** First visible item at the last visibility update. */
+	int32 FirstVisibleItem;
+
+	/** Item following the last visible item at the last visibility update. */
+	int32 FirstNotVisibleItem;
+
+	/** False if all items need their visibility set at the next visibility update. */
+	bool bVisibleItemRangeValid;
+
+	/** Class of the actors bound to data source items, null if the collection uses attached actors. */
+	UPROPERTY(Transient)
+	TSubclassOf<AActor> VirtualItemClass;
+
+	/** Data source item count callback. */
+	FUxtScrollingObjectCollectionGetItemCount GetVirtualItemCount;
+
+	/** Data source callback binding an item to an actor. */
+	FUxtScrollingObjectCollectionBindItem BindVirtualItem;
+
+	/** Item count of the data source at the last refresh. */
+	int32 NumVirtualItems;
+
+	/** First item bound to an actor. */
+	int32 FirstBoundVirtualItem;
+
+	/** Actors bound to consecutive data source items, starting at #FirstBoundVirtualItem. */
+	UPROPERTY(Transient)
+	TArray<AActor*> BoundVirtualItemActors;
+
+	/** Scratch array for rebuilding #BoundVirtualItemActors without allocations. */
+	UPROPERTY(Transient)
+	TArray<AActor*> NextBoundVirtualItemActors;
+
+	/** Pooled actors not bound to any item. */
+	UPROPERTY(Transient)
+	TArray<AActor*> FreeVirtualItemActors;
+
 #if WITH_EDITORONLY_DATA
 	/** Record whether the collection has been initialized at least once while in the editor. */
 	bool bCollectionInitializedInEditor;
@@ -9,6 +9,7 @@
 #include "Input/UxtFarPointerComponent.h"
 #include "Interactions/UxtFarHandler.h"
 #include "Interactions/UxtFarTarget.h"
+#include "Utils/UxtAsyncLineTrace.h"
 
 #include "UxtSurfaceMagnetismComponent.generated.h"
 
@@ -62,6 +63,8 @@ protected:
 	// UActorComponent interface
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void BeginPlay() override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 
 	//
 	// IUxtFarTarget interface
@@ -124,6 +127,9 @@ private:
 	/** Far pointer in use */
 	TWeakObjectPtr<UUxtFarPointerComponent> FarPointerWeak;
 
+	/** Surface trace, queued asynchronously if the far pointer uses async traces */
+	FUxtAsyncLineTrace SurfaceTrace;
+
 	/** Stored target point (used if we are smoothing location) */
 	FVector TargetLocation;
 
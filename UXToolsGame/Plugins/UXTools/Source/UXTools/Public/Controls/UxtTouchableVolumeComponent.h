@@ -56,20 +56,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Uxt Touchable Volume")
 	void SetEnabled(bool Enabled);
 
-	/** Types of interaction the volume should respond to. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Touchable Volume", meta = (Bitmask, BitmaskEnum = EUxtInteractionMode))
-	int32 InteractionMode = static_cast<int32>(EUxtInteractionMode::Near | EUxtInteractionMode::Far);
+	/** Get the types of interaction the volume responds to. */
+	UFUNCTION(BlueprintGetter, Category = "Uxt Touchable Volume")
+	int32 GetInteractionMode() const;
+
+	/** Set the types of interaction the volume responds to. */
+	UFUNCTION(BlueprintSetter, Category = "Uxt Touchable Volume")
+	void SetInteractionMode(int32 Flags);
+
+	/** Get the primitives used as touchable targets. */
+	UFUNCTION(BlueprintGetter, Category = "Uxt Touchable Volume")
+	const TSet<UPrimitiveComponent*>& GetTouchablePrimitives() const;
+
+	/** Set the primitives used as touchable targets, all primitives of the actor are used if the set is empty. */
+	UFUNCTION(BlueprintSetter, Category = "Uxt Touchable Volume")
+	void SetTouchablePrimitives(const TSet<UPrimitiveComponent*>& Primitives);
 
 	/** Should the volume lock the pointer's focus when poked. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Touchable Volume")
 	bool bLockFocus = true;
 
-	/** List of primitives used as touchable targets.
-	 * If the list is empty then all primitives of the actor are used.
-	 */
-	UPROPERTY(BlueprintReadWrite, Category = "Uxt Touchable Volume")
-	TSet<UPrimitiveComponent*> TouchablePrimitives;
-
 	//
 	// Events
 
@@ -111,6 +117,8 @@ protected:
 	//
 	// UActorComponent interface
 	virtual void BeginPlay() override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 
 	//
 	// IUxtPokeTarget interface
@@ -152,6 +160,18 @@ protected:
 	void OnInputTouchLeaveHandler(ETouchIndex::Type FingerIndex, UPrimitiveComponent* TouchedComponent);
 
 private:
+	/** Types of interaction the volume should respond to. Private so that changes invalidate the cached far targets. */
+	UPROPERTY(
+		EditAnywhere, Category = "Uxt Touchable Volume", BlueprintGetter = "GetInteractionMode", BlueprintSetter = "SetInteractionMode",
+		meta = (Bitmask, BitmaskEnum = EUxtInteractionMode))
+	int32 InteractionMode = static_cast<int32>(EUxtInteractionMode::Near | EUxtInteractionMode::Far);
+
+	/** List of primitives used as touchable targets.
+	 * If the list is empty then all primitives of the actor are used.
+	 */
+	UPROPERTY(Category = "Uxt Touchable Volume", BlueprintGetter = "GetTouchablePrimitives", BlueprintSetter = "SetTouchablePrimitives")
+	TSet<UPrimitiveComponent*> TouchablePrimitives;
+
 	/** Get the current contact state of the volume */
 	bool IsContacted() const;
 
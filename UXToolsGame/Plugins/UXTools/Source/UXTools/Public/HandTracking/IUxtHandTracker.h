@@ -7,20 +7,111 @@
 #include "HeadMountedDisplayTypes.h"
 #include "IMotionController.h"
 
+/**
+ * State of a single hand for one frame.
+ * Joint data is stored as separate contiguous arrays so that code iterating over all joints touches as little memory as possible.
+ */
+struct alignas(PLATFORM_CACHE_LINE_SIZE) FUxtHandSnapshot
+{
+	/** Value of GFrameCounter when the snapshot was taken. */
+	uint64 FrameId = 0;
+
+	/** Tracking status of the hand or motion controller. */
+	ETrackingStatus TrackingStatus = ETrackingStatus::NotTracked;
+
+	/** True if the controller is a hand, joint data is only valid in that case. */
+	bool bHasJoints = false;
+
+	/** True if the pointer pose is valid. */
+	bool bHasPointerPose = false;
+
+	/** True if the grip pose is valid. */
+	bool bHasGripPose = false;
+
+	FQuat JointOrientations[EHandKeypointCount];
+	FVector JointPositions[EHandKeypointCount];
+	float JointRadii[EHandKeypointCount];
+
+	FQuat PointerOrientation = FQuat::Identity;
+	FVector PointerPosition = FVector::ZeroVector;
+
+	FQuat GripOrientation = FQuat::Identity;
+	FVector GripPosition = FVector::ZeroVector;
+
+	/**
+	 * Fill the snapshot from motion controller data cached for the current frame.
+	 * Joint data is only copied for valid hand controllers, which must provide all keypoints.
+	 */
+	UXTOOLS_API void CopyFromMotionControllerData(const FXRMotionControllerData& MotionControllerData);
+
+	/** Same contract as IUxtHandTracker::GetJointState. */
+	bool GetJointState(EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const
+	{
+		if (bHasJoints)
+		{
+			const int32 iJoint = (int32)Joint;
+			OutOrientation = JointOrientations[iJoint];
+			OutPosition = JointPositions[iJoint];
+			OutRadius = JointRadii[iJoint];
+			return true;
+		}
+		return false;
+	}
+
+	/** Same contract as IUxtHandTracker::GetPointerPose. */
+	bool GetPointerPose(FQuat& OutOrientation, FVector& OutPosition) const
+	{
+		if (bHasPointerPose)
+		{
+			OutOrientation = PointerOrientation;
+			OutPosition = PointerPosition;
+			return true;
+		}
+		return false;
+	}
+
+	/** Same contract as IUxtHandTracker::GetGripPose. */
+	bool GetGripPose(FQuat& OutOrientation, FVector& OutPosition) const
+	{
+		if (bHasGripPose)
+		{
+			OutOrientation = GripOrientation;
+			OutPosition = GripPosition;
+			return true;
+		}
+		return false;
+	}
+};
+
 /**
  * Hand tracker device interface.
  * We assume that implementations poll and cache the hand tracking state at the beginning of the frame.
  * This allows us to assume that if a hand is reported as tracked it will remain so for the remainder of the frame,
  * simplifying client logic.
+ *
+ * Trackers that don't override GetHandSnapshot get snapshots assembled from their getters once per frame and hand.
+ * If the state of such a tracker changes during a frame it must call InvalidateHandSnapshots, otherwise callers
+ * keep seeing the state from before the change until the next frame.
  */
 class UXTOOLS_API IUxtHandTracker : public IModularFeature
 {
 public:
 	static FName GetModularFeatureName();
 
-	/** Returns the currently registered hand tracker or nullptr if none */
+	/** Returns the override hand tracker if set, otherwise the currently registered hand tracker or a fallback that tracks nothing */
 	static IUxtHandTracker& Get();
 
+	/**
+	 * Use the given hand tracker in place of the registered one, e.g. to replay a recorded session.
+	 * The registered hand tracker stays registered and is used again once the override is cleared by passing null.
+	 * Callers should restore the override they replaced (see GetOverride) when done, so that overrides can be nested.
+	 * Game thread only.
+	 */
+	static void SetOverride(IUxtHandTracker* HandTracker);
+
+	/** Hand tracker set with SetOverride, null if none. */
+	static IUxtHandTracker* GetOverride();
+
 	virtual ~IUxtHandTracker() {}
 
 	/** Get tracking status of the hand or motion controller. */
@@ -40,6 +131,13 @@ public:
 	 */
 	virtual bool GetPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const = 0;
 
+	/** Obtain the pointer pose extrapolated to when the current frame is displayed.
+	 * Intended for visuals that should line up with the hand on screen, interaction logic should keep using GetPointerPose.
+	 * The default implementation does not predict and returns the same pose as GetPointerPose.
+	 * Returns false if the hand is not tracked this frame, in which case the value of the output parameter is unchanged.
+	 */
+	virtual bool GetPredictedPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const;
+
 	/** Grip pose following the controller.
 	 * Returns false if the hand is not tracked this frame, in which case the value of the output parameter is unchanged.
 	 */
@@ -52,4 +150,36 @@ public:
 	/** Obtain current selection state.
 	 * Returns false if the hand is not tracked this frame, in which case the value of the output parameter is unchanged. */
 	virtual bool GetIsSelectPressed(EControllerHand Hand, bool& OutIsSelectPressed) const = 0;
+
+	/** Obtain joint data and poses of the hand in one call.
+	 * Prefer this over repeated GetJointState calls when reading several joints.
+	 * The default implementation assembles the snapshot from the individual getters once per frame and hand,
+	 * trackers that cache their state per frame should override it to return the cached snapshot directly.
+	 * Game thread only. The reference is only valid until the next call for the same hand.
+	 */
+	virtual const FUxtHandSnapshot& GetHandSnapshot(EControllerHand Hand) const;
+
+	/** Copy the most recently published snapshot of the hand.
+	 * Unlike GetHandSnapshot this can be called from any thread, e.g. by render thread visuals or worker tasks.
+	 * The FrameId of the snapshot tells readers which game frame the data belongs to.
+	 * Returns false if the tracker does not publish snapshots for other threads and the caller is not on the game thread.
+	 */
+	virtual bool ReadPublishedHandSnapshot(EControllerHand Hand, FUxtHandSnapshot& OutSnapshot) const;
+
+protected:
+	/** Fill a snapshot from the individual getters of this tracker. */
+	void FillHandSnapshot(EControllerHand Hand, FUxtHandSnapshot& OutSnapshot) const;
+
+	/**
+	 * Discard the snapshots assembled by the default GetHandSnapshot for this frame.
+	 * Trackers using the default implementation must call this if their state changes during a frame.
+	 */
+	void InvalidateHandSnapshots() const;
+
+private:
+	/** Snapshots assembled by the default GetHandSnapshot for the left and right hand, kept for the rest of the frame. */
+	mutable FUxtHandSnapshot FallbackSnapshots[2];
+
+	/** False if the fallback snapshot of the hand has to be assembled again, even within the same frame. */
+	mutable bool bFallbackSnapshotValid[2] = {false, false};
 };
@@ -0,0 +1,93 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+#include "Templates/Atomic.h"
+
+#include "HandTracking/IUxtHandTracker.h"
+
+/**
+ * Hand snapshots published by the game thread for readers on other threads.
+ *
+ * Implemented as a sequence lock: the writer never waits for readers,
+ * readers copy the data and retry if a new version was published while they were copying.
+ * Only one thread may publish, any number of threads may read.
+ */
+class FUxtHandSnapshotBuffer
+{
+public:
+	/** Publish snapshots for both hands. */
+	void Publish(const FUxtHandSnapshot& LeftSnapshot, const FUxtHandSnapshot& RightSnapshot)
+	{
+		const uint32 Version = Sequence.Load(EMemoryOrder::Relaxed);
+
+		// Odd sequence marks a write in progress
+		Sequence.Store(Version + 1);
+		FPlatformMisc::MemoryBarrier();
+
+		Snapshots[0] = LeftSnapshot;
+		Snapshots[1] = RightSnapshot;
+
+		Sequence.Store(Version + 2);
+	}
+
+	/** Copy the last published snapshot of the hand. Safe to call from any thread. */
+	void Read(EControllerHand Hand, FUxtHandSnapshot& OutSnapshot) const
+	{
+		const FUxtHandSnapshot& Source = Snapshots[Hand == EControllerHand::Left ? 0 : 1];
+		uint32 NumSpins = 0;
+		for (;;)
+		{
+			const uint32 Version = Sequence.Load();
+			if (Version & 1)
+			{
+				// Publishing only copies two snapshots, so spin for a while before giving up the time slice
+				if (++NumSpins >= MaxSpinCount)
+				{
+					NumSpins = 0;
+					FPlatformProcess::Yield();
+				}
+				CountReadRetry();
+				continue;
+			}
+
+			OutSnapshot = Source;
+			FPlatformMisc::MemoryBarrier();
+
+			if (Sequence.Load(EMemoryOrder::Relaxed) == Version)
+			{
+				return;
+			}
+			CountReadRetry();
+		}
+	}
+
+	/** Number of times snapshots have been published. */
+	uint32 GetNumPublished() const { return Sequence.Load() / 2; }
+
+#if WITH_DEV_AUTOMATION_TESTS
+	/** Number of times reads had to check the sequence again because of a concurrent publish. Only counted for tests. */
+	uint32 GetNumReadRetries() const { return NumReadRetries.Load(); }
+#endif
+
+private:
+	/** Number of times a reader checks for a publish in progress before it yields. */
+	static constexpr uint32 MaxSpinCount = 64;
+
+	void CountReadRetry() const
+	{
+#if WITH_DEV_AUTOMATION_TESTS
+		++NumReadRetries;
+#endif
+	}
+
+	TAtomic<uint32> Sequence{0};
+	FUxtHandSnapshot Snapshots[2];
+
+#if WITH_DEV_AUTOMATION_TESTS
+	mutable TAtomic<uint32> NumReadRetries{0};
+#endif
+};
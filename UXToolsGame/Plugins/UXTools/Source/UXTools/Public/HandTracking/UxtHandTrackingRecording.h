@@ -0,0 +1,128 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HandTracking/IUxtHandTracker.h"
+
+class FArchive;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Writes the per-frame state of a hand tracker and the head pose to a hand tracking recording file.
+ *
+ * Frames are serialized as fixed size little endian records after a small header, so that a player can seek to any frame
+ * of a memory mapped recording without parsing the frames before it. The number of frames follows from the file size,
+ * so a recording that was not closed can still be replayed up to its last complete frame.
+ */
+class UXTOOLS_API FUxtHandTrackingRecorder
+{
+public:
+	~FUxtHandTrackingRecorder();
+
+	/** Create the recording file, replacing any existing file. Returns false if the file can not be written. */
+	bool Open(const FString& Filename);
+
+	/** Finish the recording file. */
+	void Close();
+
+	bool IsOpen() const;
+
+	/** Number of frames written since the file was opened. */
+	int32 GetNumFrames() const;
+
+	/** Append the current state of both hands and the head pose. Time is in seconds since the start of the recording. */
+	void RecordFrame(const IUxtHandTracker& HandTracker, const FTransform& HeadPose, double Time);
+
+private:
+	TUniquePtr<FArchive> Writer;
+	int32 NumFrames = 0;
+};
+
+/**
+ * Hand tracker that replays a recording made with FUxtHandTrackingRecorder.
+ *
+ * The file is memory mapped where the platform supports it and loaded into memory otherwise.
+ * The tracker reports the state of the current frame until it is changed with SetFrameIndex, which makes
+ * playback frame-accurate regardless of the frame rate of the replaying application.
+ */
+class UXTOOLS_API FUxtHandTrackingPlayer : public IUxtHandTracker
+{
+public:
+	~FUxtHandTrackingPlayer();
+
+	/** Open a recording and move to its first frame. Returns false if the file is missing or not a valid recording. */
+	bool Open(const FString& Filename);
+
+	/** Release the recording. The tracker reports both hands as not tracked afterwards. */
+	void Close();
+
+	bool IsOpen() const;
+
+	int32 GetNumFrames() const;
+
+	/** Index of the frame currently reported, INDEX_NONE if no recording is open. */
+	int32 GetFrameIndex() const;
+
+	/** Move to the given frame. Returns false if the index is out of range, in which case the current frame is unchanged. */
+	bool SetFrameIndex(int32 FrameIndex);
+
+	/** Time of the current frame in seconds since the start of the recording. */
+	double GetFrameTime() const;
+
+	/**
+	 * Time in seconds between the given frame and the frame before it, i.e. the delta time the recorded application ticked with.
+	 * The first frame is assumed to take as long as the second. Returns zero if the recording has less than two frames.
+	 */
+	double GetFrameDeltaTime(int32 FrameIndex) const;
+
+	/** Head pose recorded in the current frame. */
+	const FTransform& GetHeadPose() const;
+
+	//
+	// IUxtHandTracker interface
+
+	virtual ETrackingStatus GetTrackingStatus(EControllerHand Hand) const override;
+	virtual bool IsHandController(EControllerHand Hand) const override;
+	virtual bool GetJointState(
+		EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const override;
+	virtual bool GetPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
+	virtual bool GetPredictedPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
+	virtual bool GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
+	virtual bool GetIsGrabbing(EControllerHand Hand, bool& OutIsGrabbing) const override;
+	virtual bool GetIsSelectPressed(EControllerHand Hand, bool& OutIsSelectPressed) const override;
+	virtual const FUxtHandSnapshot& GetHandSnapshot(EControllerHand Hand) const override;
+
+private:
+	/** Recorded input state of a hand that is not part of the hand snapshot. */
+	struct FHandInputState
+	{
+		bool bIsHandController = false;
+		bool bHasGrabState = false;
+		bool bIsGrabbing = false;
+		bool bHasSelectState = false;
+		bool bIsSelectPressed = false;
+	};
+
+	void ClearFrame();
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** File contents when memory mapping is not available. */
+	TArray<uint8> FileData;
+
+	/** First frame record of the recording. */
+	const uint8* FrameData = nullptr;
+	int32 NumFrames = 0;
+
+	int32 FrameIndex = INDEX_NONE;
+	double FrameTime = 0.0;
+	FTransform HeadPose = FTransform::Identity;
+
+	FUxtHandSnapshot Snapshots[2];
+	FHandInputState InputStates[2];
+};
@@ -0,0 +1,93 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Engine/EngineBaseTypes.h"
+#include "HandTracking/UxtHandTrackingRecording.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "UxtHandTrackingRecordingSubsystem.generated.h"
+
+/**
+ * World subsystem that records hand tracking sessions and replays them by overriding the active hand tracker.
+ *
+ * Recording captures the hand tracker state and head pose after actors have ticked, i.e. the state that interactions
+ * saw during the frame. Playback advances one recorded frame per world tick, before any actor or hand tracker update,
+ * and switches the engine to a fixed time step following the recorded frame times. A replayed session therefore
+ * exercises the same interaction code paths with the same delta times on every run, including in headless builds
+ * without XR devices.
+ */
+UCLASS(ClassGroup = "UXTools")
+class UXTOOLS_API UUxtHandTrackingRecordingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//
+	// USubsystem interface
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Start recording to the given file, replacing it if it exists. Returns false if the file can not be created. */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Hand Tracking Recording")
+	bool StartRecording(const FString& Filename);
+
+	/** Stop recording and finish the file. */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Hand Tracking Recording")
+	void StopRecording();
+
+	UFUNCTION(BlueprintPure, Category = "UXTools|Hand Tracking Recording")
+	bool IsRecording() const;
+
+	/**
+	 * Override the hand tracker and head pose with the given recording, the registered hand tracker stays registered.
+	 * The engine ticks with the recorded delta times while playing, which affects all worlds.
+	 * Playback stops after the last frame unless bLoop is set. Returns false if the file is not a valid recording.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Hand Tracking Recording")
+	bool StartPlayback(const FString& Filename, bool bLoop = false);
+
+	/** Stop playback, restore the previous hand tracker override and time step and clear the head pose override. */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Hand Tracking Recording")
+	void StopPlayback();
+
+	UFUNCTION(BlueprintPure, Category = "UXTools|Hand Tracking Recording")
+	bool IsPlaying() const;
+
+	/** Index of the recorded frame being replayed, INDEX_NONE if not playing. */
+	UFUNCTION(BlueprintPure, Category = "UXTools|Hand Tracking Recording")
+	int32 GetPlaybackFrameIndex() const;
+
+private:
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaTime);
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaTime);
+
+	/** Apply the head pose of the current playback frame. */
+	void ApplyPlaybackHeadPose();
+
+	/** Set the fixed delta time of the next engine frame to the recorded delta time of the next playback frame. */
+	void UpdatePlaybackDeltaTime();
+
+	FUxtHandTrackingRecorder Recorder;
+	FUxtHandTrackingPlayer Player;
+
+	/** App time when recording started, frame times are stored relative to it. */
+	double RecordingStartTime = 0.0;
+
+	bool bLoopPlayback = false;
+
+	/** Frame counter of the last playback update, to advance exactly one recorded frame per engine frame. */
+	uint64 PlaybackFrameId = 0;
+
+	/** State replaced while playing, restored when playback stops. */
+	IUxtHandTracker* PreviousOverrideHandTracker = nullptr;
+	bool bPreviousUseFixedTimeStep = false;
+	double PreviousFixedDeltaTime = 0.0;
+
+	FDelegateHandle TickStartDelegateHandle;
+	FDelegateHandle PostActorTickDelegateHandle;
+};
@@ -0,0 +1,109 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Constant velocity predictor for a tracked pose.
+ *
+ * Velocities are estimated over a fixed window of recent samples, like the hand velocity of AUxtHandInteractionActor,
+ * and the latest pose is extrapolated along them. Samples are kept in a fixed size ring buffer so that adding samples
+ * and predicting never allocates.
+ */
+class FUxtPosePredictor
+{
+public:
+	/** Number of samples velocities are estimated over. */
+	static constexpr int32 WindowSize = 6;
+
+	/**
+	 * Samples older than this, relative to the latest update, are not extrapolated.
+	 * The pose has not changed for that long, so the hand is assumed to be held still.
+	 */
+	static constexpr double MaxSampleAge = 0.1;
+
+	/** Discard all samples, e.g. on tracking loss. */
+	void Reset() { NumSamples = 0; }
+
+	/**
+	 * Add the pose sampled at the given time. Updates that are not newer than the last one are ignored.
+	 * A pose equal to the latest sample is a repeated runtime sample, e.g. when tracking updates slower than the frame rate.
+	 * It keeps the time it was first reported at, so that repeats do not distort the velocity.
+	 */
+	void AddSample(const FQuat& Orientation, const FVector& Position, double Time)
+	{
+		if (NumSamples > 0)
+		{
+			if (Time <= LatestTime)
+			{
+				return;
+			}
+
+			LatestTime = Time;
+			if (Positions[Newest] == Position && Orientations[Newest] == Orientation)
+			{
+				return;
+			}
+		}
+
+		Newest = (Newest + 1) % WindowSize;
+		Orientations[Newest] = Orientation;
+		Positions[Newest] = Position;
+		Times[Newest] = Time;
+		LatestTime = Time;
+		NumSamples = FMath::Min(NumSamples + 1, WindowSize);
+	}
+
+	/**
+	 * Extrapolate the pose by the given time past the latest update.
+	 * Returns the latest pose unchanged until two samples are available or once it is older than @ref MaxSampleAge,
+	 * and false if there are no samples at all.
+	 */
+	bool Predict(float Horizon, FQuat& OutOrientation, FVector& OutPosition) const
+	{
+		if (NumSamples == 0)
+		{
+			return false;
+		}
+
+		OutOrientation = Orientations[Newest];
+		OutPosition = Positions[Newest];
+
+		const double SampleAge = LatestTime - Times[Newest];
+		if (NumSamples < 2 || Horizon <= 0.0f || SampleAge > MaxSampleAge)
+		{
+			return true;
+		}
+
+		// Repeated samples leave the latest pose behind the latest update, extrapolate over that gap as well
+		const int32 Oldest = (Newest + WindowSize - NumSamples + 1) % WindowSize;
+		const float Scale = static_cast<float>((Horizon + SampleAge) / (Times[Newest] - Times[Oldest]));
+
+		OutPosition += (Positions[Newest] - Positions[Oldest]) * Scale;
+
+		FQuat DeltaRotation = Orientations[Newest] * Orientations[Oldest].Inverse();
+		DeltaRotation.EnforceShortestArcWith(FQuat::Identity);
+		FVector Axis;
+		float Angle;
+		DeltaRotation.ToAxisAndAngle(Axis, Angle);
+		OutOrientation = FQuat(Axis, Angle * Scale) * OutOrientation;
+		OutOrientation.Normalize();
+
+		return true;
+	}
+
+private:
+	FQuat Orientations[WindowSize];
+	FVector Positions[WindowSize];
+	double Times[WindowSize];
+
+	/** Index of the most recent sample in the ring buffer. */
+	int32 Newest = 0;
+
+	/** Time of the latest update, including repeated samples. */
+	double LatestTime = 0.0;
+
+	int32 NumSamples = 0;
+};
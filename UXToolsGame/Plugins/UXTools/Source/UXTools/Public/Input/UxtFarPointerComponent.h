@@ -8,6 +8,9 @@
 #include "InputCoreTypes.h"
 #include "UxtPointerComponent.h"
 
+#include "Utils/UxtAsyncLineTrace.h"
+#include "Utils/UxtOneEuroFilter.h"
+
 #include "Components/ActorComponent.h"
 #include "Materials/MaterialParameterCollection.h"
 
@@ -31,8 +34,8 @@ class UXTOOLS_API UUxtFarPointerComponent : public UUxtPointerComponent
 public:
 	UUxtFarPointerComponent();
 
-	/** Origin of the pointer ray as reported by the hand tracker. See GetRayStart() for actual start of the ray used for querying the
-	 * scene. */
+	/** Origin of the pointer ray as reported by the hand tracker, filtered if enabled. See GetRayStart() for actual start of the ray
+	 * used for querying the scene. */
 	UFUNCTION(BlueprintCallable, Category = "Uxt Far Pointer")
 	FVector GetPointerOrigin() const;
 
@@ -45,6 +48,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Uxt Far Pointer")
 	FVector GetRayStart() const;
 
+	/**
+	 * Pointer origin predicted to when the current frame is displayed, filtered if enabled.
+	 * Intended for visuals such as the beam, interaction uses the pointer origin.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Far Pointer")
+	FVector GetPredictedPointerOrigin() const;
+
+	/** Pointer orientation predicted to when the current frame is displayed, filtered if enabled. */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Far Pointer")
+	FQuat GetPredictedPointerOrientation() const;
+
+	/** Start of the ray for the predicted pointer pose. */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Far Pointer")
+	FVector GetPredictedRayStart() const;
+
+	/**
+	 * Hit point moved along the hit surface to where the predicted pointer ray meets it.
+	 * Intended for visuals such as the cursor, the hit point used for interaction is not predicted.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Far Pointer")
+	FVector GetPredictedHitPoint() const;
+
+	/**
+	 * Pose at which the pointer ray is queued when using async traces. This is the current pointer pose extrapolated by the pointer
+	 * velocity over one frame if latency compensation is enabled.
+	 */
+	FTransform GetAsyncTracePose() const;
+
 	/** Primitive the pointer is currently hitting or null if none. */
 	UFUNCTION(BlueprintCallable, Category = "Uxt Far Pointer")
 	UPrimitiveComponent* GetHitPrimitive() const;
@@ -79,9 +110,16 @@ public:
 	virtual FTransform GetCursorTransform() const override;
 
 private:
+	/** Offset the new pointer pose by the change the hand tracker predicts until display time. */
+	void UpdatePredictedPointerPose(
+		const FQuat& RawOrientation, const FVector& RawOrigin, const FQuat& NewOrientation, const FVector& NewOrigin);
+
 	/** Called every tick to update the pointer pose with the latest information from the hand tracker. */
 	void OnPointerPoseUpdated(const FQuat& NewOrientation, const FVector& NewOrigin);
 
+	/** Estimate the pointer velocity from the change in pose since the last tick. */
+	void UpdatePointerVelocity(const FQuat& NewOrientation, const FVector& NewOrigin, float DeltaTime);
+
 	/** Called every tick to update the pressed state with the latest information from the hand tracker. */
 	void SetPressed(bool bNewPressed);
 
@@ -108,6 +146,31 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer")
 	float RayLength = 500;
 
+	/**
+	 * Queue the pointer ray trace asynchronously and use its result in the next frame.
+	 * Moves the trace off the game thread critical path at the cost of one frame of latency.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay)
+	bool bAsyncTrace = false;
+
+	/** Extrapolate async traces by the pointer velocity to hide their frame of latency. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay, meta = (EditCondition = "bAsyncTrace"))
+	bool bCompensateTraceLatency = true;
+
+	/** Smooth the pointer pose with an adaptive filter to steady the ray while keeping fast movements responsive. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay)
+	bool bFilterPointerPose = false;
+
+	/** Filter settings for the pointer origin, speed is measured in units per second. */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay, meta = (EditCondition = "bFilterPointerPose"))
+	FUxtOneEuroFilterSettings PointerOriginFilterSettings = FUxtOneEuroFilterSettings(2.0f, 0.05f, 1.0f);
+
+	/** Filter settings for the pointer orientation, speed is measured in radians per second. */
+	UPROPERTY(
+		EditAnywhere, BlueprintReadWrite, Category = "Uxt Far Pointer", AdvancedDisplay, meta = (EditCondition = "bFilterPointerPose"))
+	FUxtOneEuroFilterSettings PointerOrientationFilterSettings = FUxtOneEuroFilterSettings(1.0f, 0.5f, 1.0f);
+
 	UPROPERTY(BlueprintAssignable, Category = "Uxt Far Pointer")
 	FUxtFarPointerEnabledDelegate OnFarPointerEnabled;
 
@@ -127,6 +190,26 @@ private:
 	/** Pointer orientation. */
 	FQuat PointerOrientation = FQuat::Identity;
 
+	/** Pointer pose predicted to display time, only used by visuals. */
+	FVector PredictedPointerOrigin = FVector::ZeroVector;
+	FQuat PredictedPointerOrientation = FQuat::Identity;
+
+	/** Pointer velocities used to compensate the latency of async traces. */
+	FVector PointerLinearVelocity = FVector::ZeroVector;
+	FVector PointerAngularVelocity = FVector::ZeroVector;
+
+	/** Time the async trace result is expected to lag behind, estimated from the last tick. */
+	float AsyncTraceLatency = 0.0f;
+
+	/** True if the pose of the last tick was tracked, velocities are zero until two consecutive tracked poses exist. */
+	bool bHasPreviousSample = false;
+
+	FUxtAsyncLineTrace PointerTrace;
+
+	/** Filter state used when bFilterPointerPose is set. */
+	FUxtOneEuroVectorFilter PointerOriginFilter;
+	FUxtOneEuroQuatFilter PointerOrientationFilter;
+
 	TWeakObjectPtr<UPrimitiveComponent> HitPrimitiveWeak;
 	FVector HitPoint = FVector::ZeroVector;
 	FVector HitNormal = FVector::BackwardVector;
@@ -0,0 +1,46 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UBodySetup;
+class UPrimitiveComponent;
+
+/**
+ * Geometry of a front face pokable primitive used by the front face poke tests.
+ * Rebuilt only when the primitive, its transform, its body setup or its bounds change.
+ */
+struct UXTOOLS_API FUxtFrontFacePokeGeometry
+{
+public:
+	/** Update the cached geometry for the given primitive if necessary. Returns true if the geometry was rebuilt. */
+	bool Update(UPrimitiveComponent* Primitive);
+
+	/** True if the collision of the primitive consists only of boxes. */
+	bool bIsBoxShape = false;
+
+	/** Extent of the local bounds of the primitive. */
+	FVector LocalExtent = FVector::ZeroVector;
+
+	/** Extent of the local bounds, scaled by the component scale. */
+	FVector ScaledExtent = FVector::ZeroVector;
+
+	/** Scale along the X axis of the component. */
+	float ScaleX = 1.0f;
+
+	/** Inverse of the component transform including scale. */
+	FMatrix InverseTransform = FMatrix::Identity;
+
+	/** Inverse of the component transform without scale. */
+	FMatrix InverseTransformNoScale = FMatrix::Identity;
+
+private:
+	TWeakObjectPtr<const UPrimitiveComponent> PrimitiveWeak;
+	const UBodySetup* BodySetup = nullptr;
+	FTransform ComponentTransform;
+	FBoxSphereBounds Bounds;
+};
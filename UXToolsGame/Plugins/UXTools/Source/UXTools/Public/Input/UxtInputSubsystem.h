@@ -7,15 +7,116 @@
 
 #include "Components/ActorComponent.h"
 #include "Components/PrimitiveComponent.h"
+#include "Engine/EngineBaseTypes.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 
 #include "UxtInputSubsystem.generated.h"
 
+class AActor;
 class UUxtFarHandler;
 class UUxtFarPointerComponent;
 class UUxtGrabHandler;
+class UUxtInputSubsystem;
 class UUxtNearPointerComponent;
+class UUxtPointerComponent;
 class UUxtPokeHandler;
+class UWorld;
+
+/** List of components implementing an interface, most actors only have one or two. */
+using FUxtInterfaceComponentArray = TArray<TWeakObjectPtr<UActorComponent>, TInlineAllocator<2>>;
+
+/** Handlers receiving a single event, stored inline to avoid allocations when dispatching. */
+using FUxtHandlerArray = TArray<UObject*, TInlineAllocator<8>>;
+
+/** Cached list of the components of an actor that implement a given interface. */
+struct FUxtInterfaceComponentCacheEntry
+{
+	/** Interface implemented by the components. */
+	UClass* Interface = nullptr;
+
+	/** Components implementing the interface, components registered after the entry was built are appended. */
+	FUxtInterfaceComponentArray Components;
+
+	/** Changes whenever the entry is rebuilt or invalidated, so that data derived from it can be validated. */
+	uint32 Revision = 0;
+};
+
+/** Interface component entries of a single actor. */
+struct FUxtActorInterfaceComponentCache
+{
+	/** Number of components owned by the actor when the entries were built, detects components that do not notify the subsystem. */
+	int32 NumComponents = 0;
+
+	/** One entry per queried interface, most actors are only queried for a few interfaces. */
+	TArray<FUxtInterfaceComponentCacheEntry, TInlineAllocator<4>> Entries;
+};
+
+/** Cached far target of a primitive. */
+struct FUxtFarTargetCacheEntry
+{
+	/** Far target the primitive belongs to, if any. */
+	TWeakObjectPtr<UObject> FarTarget;
+
+	/** Revision of the actor's far target interface entry when the entry was built. */
+	uint32 FarTargetsRevision = 0;
+
+	/** True if a far target was found, used to detect far targets that have been destroyed since. */
+	bool bHasFarTarget = false;
+};
+
+/** Type of a pointer event raised through the input subsystem. */
+enum class EUxtInputEventType : uint8
+{
+	EnterFarFocus,
+	UpdatedFarFocus,
+	ExitFarFocus,
+	FarPressed,
+	FarDragged,
+	FarReleased,
+	EnterGrabFocus,
+	UpdateGrabFocus,
+	ExitGrabFocus,
+	BeginGrab,
+	UpdateGrab,
+	EndGrab,
+	EnterPokeFocus,
+	UpdatePokeFocus,
+	ExitPokeFocus,
+	BeginPoke,
+	UpdatePoke,
+	EndPoke,
+};
+
+/** Pointer event waiting in the input event queue. */
+struct FUxtQueuedInputEvent
+{
+	TWeakObjectPtr<UPrimitiveComponent> Target;
+	TWeakObjectPtr<UUxtPointerComponent> Pointer;
+	EUxtInputEventType Type;
+};
+
+/** Tick function flushing the input event queue once per frame. */
+USTRUCT()
+struct FUxtInputEventQueueTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	/** Subsystem owning the event queue. */
+	UUxtInputSubsystem* Subsystem = nullptr;
+
+	virtual void ExecuteTick(
+		float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FUxtInputEventQueueTickFunction> : public TStructOpsTypeTraitsBase2<FUxtInputEventQueueTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
 
 /** Subsystem for dispatching events to interested handlers. */
 UCLASS(ClassGroup = "UXTools")
@@ -24,6 +125,35 @@ class UXTOOLS_API UUxtInputSubsystem : public UGameInstanceSubsystem
 	GENERATED_BODY()
 
 public:
+	//
+	// USubsystem interface
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Enable or disable queued event dispatch.
+	 * While enabled, pointer events are queued and dispatched in a single batch at the given tick group instead of immediately.
+	 * Consecutive update events for the same target and pointer are merged into one.
+	 * Disabling the queue dispatches all pending events.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Input", meta = (WorldContext = "WorldContextObject"))
+	static void SetEventQueueEnabled(
+		UObject* WorldContextObject, bool bEnabled, TEnumAsByte<ETickingGroup> FlushTickGroup = TG_PostPhysics);
+
+	/** Returns true if pointer events are queued instead of dispatched immediately. */
+	UFUNCTION(BlueprintPure, Category = "UXTools|Input", meta = (WorldContext = "WorldContextObject"))
+	static bool IsEventQueueEnabled(UObject* WorldContextObject);
+
+	/** Dispatch all queued pointer events. */
+	void FlushEventQueue();
+
+	/**
+	 * Dispatch the queued events of the given pointer immediately, in the order they were raised.
+	 * Pointers call this before they are destroyed, since events of destroyed pointers are discarded.
+	 */
+	static void FlushPointerEvents(UUxtPointerComponent* Pointer);
+
 	/** Register the given handler as interested in events for a given handler interface. */
 	UFUNCTION(BlueprintCallable, Category = "UXTools|Input")
 	static bool RegisterHandler(UObject* Handler, TSubclassOf<UInterface> Interface);
@@ -32,6 +162,37 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UXTools|Input")
 	static bool UnregisterHandler(UObject* Handler, TSubclassOf<UInterface> Interface);
 
+	/**
+	 * Get the components of the actor that implement the given interface.
+	 * Results are cached per actor, rebuilt when the number of components owned by the actor changes,
+	 * and updated when components register or unregister through RegisterInterfaceComponent.
+	 * Components destroyed since then are returned as invalid weak pointers.
+	 */
+	static FUxtInterfaceComponentArray GetInterfaceComponents(AActor* Actor, TSubclassOf<UInterface> Interface);
+
+	/**
+	 * Add the component to the cached interface components of its owner.
+	 * Components implementing input target or handler interfaces call this from OnRegister.
+	 */
+	static void RegisterInterfaceComponent(UActorComponent* Component);
+
+	/** Remove the component from the cached interface components of its owner, called from OnUnregister. */
+	static void UnregisterInterfaceComponent(UActorComponent* Component);
+
+	/**
+	 * Get the far target the primitive belongs to: the first component of the primitive's actor that implements UUxtFarTarget
+	 * and reports the primitive as far focusable. Results are cached per primitive until the actor's far targets change,
+	 * the far target is destroyed, or InvalidateFarTargets is called.
+	 */
+	static UObject* GetFarTarget(UPrimitiveComponent* Primitive);
+
+	/**
+	 * Discard the cached far targets of the actor's primitives.
+	 * Far targets must call this when IsFarFocusable changes its result for any primitive of the actor.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Input")
+	static void InvalidateFarTargets(AActor* Actor);
+
 	/** Raised when a far pointer starts focusing a primitive. */
 	UFUNCTION(BlueprintCallable, Category = "UXTools|Input")
 	static void RaiseEnterFarFocus(UPrimitiveComponent* Target, UUxtFarPointerComponent* Pointer);
@@ -107,7 +268,7 @@ public:
 private:
 	/** Dispatch the given event to interested handlers. */
 	template <typename HandlerType, typename FuncType>
-	void RaiseEvent(UPrimitiveComponent* Target, const FuncType& Callback) const;
+	void RaiseEvent(UPrimitiveComponent* Target, const FuncType& Callback);
 
 	/** Can the given handler handle events for the given primitive. */
 	template <typename HandlerType>
@@ -122,28 +283,106 @@ private:
 
 	/** Dispatch the given event to interested handlers that share a parent Actor with Target. */
 	template <typename HandlerType, typename FuncType>
-	void ExecuteHierarchy(UPrimitiveComponent* Target, const FuncType& Callback, const TSet<UObject*>& Handled) const;
+	void ExecuteHierarchy(UPrimitiveComponent* Target, const FuncType& Callback, const FUxtHandlerArray& Handled);
+
+	/** Add the event to the queue if queued dispatch is enabled. Returns false if the event should be dispatched immediately. */
+	bool QueueEvent(EUxtInputEventType Type, UPrimitiveComponent* Target, UUxtPointerComponent* Pointer);
+
+	/** Dispatch a queued event to interested handlers. */
+	static void DispatchQueuedEvent(const FUxtQueuedInputEvent& Event);
+
+	/** Register the flush tick function in the given world. */
+	void RegisterEventQueueTickFunction(UWorld* World);
+
+	/** Unregister the flush tick function when its world is cleaned up. */
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	/** Remove cache entries of objects that have been garbage collected. */
+	void OnPostGarbageCollect();
+
+	/** Find the cache entry for the given actor and interface, building it if the actor's entries have been invalidated. */
+	const FUxtInterfaceComponentCacheEntry& FindOrAddInterfaceComponents(AActor* Actor, UClass* Interface);
+
+	/** Add the component to or remove it from the cached entries of its owner for the interfaces it implements. */
+	void UpdateInterfaceComponents(UActorComponent* Component, bool bRegistered);
+
+	/** Remove cache entries of actors that have been destroyed and destroyed components from the remaining entries. */
+	void PruneInterfaceComponentCache();
+
+	/** Find the cached far target of the primitive, rebuilding the entry if the owner's far target entry has changed. */
+	UObject* FindOrAddFarTarget(UPrimitiveComponent* Primitive);
+
+	/** Remove cache entries of primitives that have been destroyed. */
+	void PruneFarTargetCache();
 
 private:
 	// Map contains array of listeners for each type of handler registered
 	TMap<UClass*, TSet<UObject*>> Listeners;
+
+	// Interface components of actors, one entry per queried interface
+	TMap<TWeakObjectPtr<const AActor>, FUxtActorInterfaceComponentCache> InterfaceComponentCache;
+
+	// Revision assigned to the next rebuilt or invalidated interface component entry
+	uint32 NextInterfaceComponentsRevision = 1;
+
+	// Cache size at which stale entries are pruned next
+	int32 InterfaceComponentCachePruneSize = 64;
+
+	// Far targets of primitives, an entry with a null target means the primitive is not far focusable
+	TMap<TWeakObjectPtr<const UPrimitiveComponent>, FUxtFarTargetCacheEntry> FarTargetCache;
+
+	// Cache size at which stale far target entries are pruned next
+	int32 FarTargetCachePruneSize = 64;
+
+	// Pointer events waiting to be dispatched, reused between frames
+	TArray<FUxtQueuedInputEvent> EventQueue;
+
+	// Events being dispatched by the current flush
+	TArray<FUxtQueuedInputEvent> FlushingEvents;
+
+	// Index of the event being dispatched by the current flush
+	int32 FlushingEventIndex = 0;
+
+	// Tick function that flushes the event queue
+	FUxtInputEventQueueTickFunction EventQueueTickFunction;
+
+	// World in which the tick function is registered
+	TWeakObjectPtr<UWorld> EventQueueWorld;
+
+	FDelegateHandle WorldCleanupHandle;
+
+	FDelegateHandle PostGarbageCollectHandle;
+
+	bool bEventQueueEnabled = false;
+
+	bool bIsFlushingEvents = false;
 };
 
 template <typename HandlerType, typename FuncType>
-void UUxtInputSubsystem::RaiseEvent(UPrimitiveComponent* Target, const FuncType& Callback) const
+void UUxtInputSubsystem::RaiseEvent(UPrimitiveComponent* Target, const FuncType& Callback)
 {
 	// If a global listener is under the same actor as Target, dispatching an event to it
 	// would duplicate the event, as it will also be dispatched here and in ExecuteHierarchy.
 	// In these situations, in order to only dispatch once, we keep track of a set of handlers
 	// that have already received this event.
-	TSet<UObject*> Handled;
+	FUxtHandlerArray Handled;
 
-	for (UObject* Handler : Listeners.FindRef(HandlerType::StaticClass()))
+	if (const TSet<UObject*>* HandlerListeners = Listeners.Find(HandlerType::StaticClass()))
 	{
-		if (CanHandle<HandlerType>(Handler, Target))
+		// Copy the listeners, handlers may register or unregister while handling the event
+		FUxtHandlerArray GlobalHandlers;
+		for (UObject* Handler : *HandlerListeners)
+		{
+			GlobalHandlers.Add(Handler);
+		}
+
+		for (UObject* Handler : GlobalHandlers)
 		{
-			Callback(Handler);
-			Handled.Add(Handler);
+			if (CanHandle<HandlerType>(Handler, Target))
+			{
+				Callback(Handler);
+				Handled.Add(Handler);
+			}
 		}
 	}
 
@@ -151,13 +390,17 @@ void UUxtInputSubsystem::RaiseEvent(UPrimitiveComponent* Target, const FuncType&
 }
 
 template <typename HandlerType, typename FuncType>
-void UUxtInputSubsystem::ExecuteHierarchy(UPrimitiveComponent* Target, const FuncType& Callback, const TSet<UObject*>& Handled) const
+void UUxtInputSubsystem::ExecuteHierarchy(UPrimitiveComponent* Target, const FuncType& Callback, const FUxtHandlerArray& Handled)
 {
 	if (Target && Target->GetOwner())
 	{
-		for (UActorComponent* Child : Target->GetOwner()->GetComponents())
+		// Copy the cached handlers, components may be added while handling the event
+		const FUxtInterfaceComponentArray Handlers =
+			FindOrAddInterfaceComponents(Target->GetOwner(), HandlerType::StaticClass()).Components;
+		for (const TWeakObjectPtr<UActorComponent>& HandlerWeak : Handlers)
 		{
-			if (Child->Implements<HandlerType>() && CanHandle<HandlerType>(Child, Target) && !Handled.Contains(Child))
+			UActorComponent* Child = HandlerWeak.Get();
+			if (Child && CanHandle<HandlerType>(Child, Target) && !Handled.Contains(Child))
 			{
 				Callback(Child);
 			}
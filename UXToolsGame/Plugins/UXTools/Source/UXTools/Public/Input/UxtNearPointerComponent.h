@@ -15,6 +15,7 @@
 struct FUxtPointerFocus;
 struct FUxtGrabPointerFocus;
 struct FUxtPokePointerFocus;
+struct FUxtNearPointerCandidates;
 class UMaterialParameterCollection;
 
 /**
@@ -128,6 +129,9 @@ protected:
 	/** Focus of the poke pointer */
 	FUxtPokePointerFocus* PokeFocus;
 
+	/** Candidates for the grab and poke focus search */
+	FUxtNearPointerCandidates* FocusCandidates;
+
 private:
 	void UpdateParameterCollection(FVector IndexTipPosition);
 
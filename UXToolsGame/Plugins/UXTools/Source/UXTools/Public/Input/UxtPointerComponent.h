@@ -21,6 +21,11 @@ class UXTOOLS_API UUxtPointerComponent : public UActorComponent
 public:
 	UUxtPointerComponent() = default;
 
+	//
+	// UActorComponent interface
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/** Get the lock state of the pointer. */
 	UFUNCTION(BlueprintCallable, Category = "Uxt Pointer")
 	bool GetFocusLocked() const;
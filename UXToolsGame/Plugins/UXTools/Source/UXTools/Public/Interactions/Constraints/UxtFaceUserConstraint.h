@@ -20,8 +20,9 @@ class UXTOOLS_API UUxtFaceUserConstraint : public UUxtTransformConstraint
 {
 	GENERATED_BODY()
 public:
-	virtual EUxtTransformMode GetConstraintType() const;
-	virtual void ApplyConstraint(FTransform& Transform) const;
+	virtual EUxtTransformMode GetConstraintType() const override;
+	virtual void ApplyConstraint(FTransform& Transform) const override;
+	virtual bool UsesHeadPose() const override { return true; }
 
 public:
 	/** Option to use this constraint to face away from the user. */
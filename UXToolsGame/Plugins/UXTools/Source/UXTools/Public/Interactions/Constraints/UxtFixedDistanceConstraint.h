@@ -24,6 +24,7 @@ public:
 	virtual void Initialize(const FTransform& WorldPose) override;
 	virtual EUxtTransformMode GetConstraintType() const override;
 	virtual void ApplyConstraint(FTransform& Transform) const override;
+	virtual bool UsesHeadPose() const override;
 
 public:
 	/** Component to fix distance to. Defaults to the head. */
@@ -23,6 +23,7 @@ public:
 	virtual void Initialize(const FTransform& WorldPose) override;
 	virtual EUxtTransformMode GetConstraintType() const override;
 	virtual void ApplyConstraint(FTransform& Transform) const override;
+	virtual bool UsesHeadPose() const override { return true; }
 
 private:
 	/** The initial distance from the object to the head. */
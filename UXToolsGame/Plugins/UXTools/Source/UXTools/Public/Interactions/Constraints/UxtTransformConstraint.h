@@ -31,15 +31,42 @@ public:
 	/** Intended to be called on manipulation started */
 	virtual void Initialize(const FTransform& WorldPose);
 
+	/**
+	 * Whether ApplyConstraint reads @ref GetHeadPose.
+	 * The head pose is then fetched once per frame for all constraints of a manipulator.
+	 */
+	virtual bool UsesHeadPose() const { return false; }
+
+	/** Called by the manipulator before applying the constraint if @ref UsesHeadPose returns true. */
+	void SetHeadPose(const FTransform& NewHeadPose) const;
+
 public:
-	/** Whether this constraint applies to one hand manipulation, two hand manipulation or both. */
+	/**
+	 * Whether this constraint applies to one hand manipulation, two hand manipulation or both.
+	 * Read by the manipulator when a manipulation starts, changes during a manipulation take effect at the next one.
+	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Constraint", meta = (Bitmask, BitmaskEnum = EUxtGrabMode))
 	int32 HandType = static_cast<int32>(EUxtGrabMode::OneHanded | EUxtGrabMode::TwoHanded);
 
-	/** Whether this constraint applies to near manipulation, far manipulation or both. */
+	/**
+	 * Whether this constraint applies to near manipulation, far manipulation or both.
+	 * Read by the manipulator when a manipulation starts, changes during a manipulation take effect at the next one.
+	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Constraint", meta = (Bitmask, BitmaskEnum = EUxtInteractionMode))
 	int32 InteractionMode = static_cast<int32>(EUxtInteractionMode::Near | EUxtInteractionMode::Far);
 
 protected:
+	/**
+	 * Head pose of the current frame.
+	 * The manipulator applying the constraint sets it once per frame, otherwise it is fetched on the first call in a frame.
+	 */
+	const FTransform& GetHeadPose() const;
+
 	FTransform WorldPoseOnManipulationStart;
+
+private:
+	mutable FTransform HeadPose;
+
+	/** Frame in which @ref HeadPose was last set. */
+	mutable uint64 HeadPoseFrame = 0;
 };
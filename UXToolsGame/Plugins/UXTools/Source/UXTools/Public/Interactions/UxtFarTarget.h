@@ -21,7 +21,11 @@ class UXTOOLS_API IUxtFarTarget
 	GENERATED_BODY()
 
 public:
-	/** Returns true if the given primitive should be considerered a valid focus target. */
+	/**
+	 * Returns true if the given primitive should be considerered a valid focus target.
+	 * The result is cached per primitive by the input subsystem. Implementations whose result changes, e.g. when they are
+	 * enabled or disabled, must call UUxtInputSubsystem::InvalidateFarTargets on their owner.
+	 */
 	UFUNCTION(BlueprintNativeEvent, Category = "Uxt Far Target")
 	bool IsFarFocusable(const UPrimitiveComponent* Primitive) const;
 };
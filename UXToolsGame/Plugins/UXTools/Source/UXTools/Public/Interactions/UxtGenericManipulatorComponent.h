@@ -65,6 +65,21 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Generic Manipulator", meta = (ClampMin = "0.0"))
 	float LerpTime = 0.08f;
 
+	/**
+	 * Use an adaptive One Euro filter instead of LerpTime for smoothing.
+	 * Jitter is removed when moving slowly while fast movements follow the hands with less lag.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Generic Manipulator")
+	bool bUseAdaptiveSmoothing = false;
+
+	/** Adaptive smoothing of the location, speed is measured in units per second. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Generic Manipulator", meta = (EditCondition = "bUseAdaptiveSmoothing"))
+	FUxtOneEuroFilterSettings AdaptiveLocationSmoothing = FUxtOneEuroFilterSettings(2.0f, 0.05f, 1.0f);
+
+	/** Adaptive smoothing of the rotation, speed is measured in radians per second. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt Generic Manipulator", meta = (EditCondition = "bUseAdaptiveSmoothing"))
+	FUxtOneEuroFilterSettings AdaptiveRotationSmoothing = FUxtOneEuroFilterSettings(2.0f, 0.5f, 1.0f);
+
 private:
 	bool IsNearManipulation() const;
 
@@ -74,6 +89,8 @@ private:
 	UFUNCTION(Category = "Uxt Generic Manipulator")
 	void OnRelease(UUxtGrabTargetComponent* Grabbable, FUxtGrabPointerData GrabPointer);
 
+	void ApplySmoothing(float DeltaTime, FTransform& InOutTargetTransform);
+
 	/** Was the target simulating physics */
 	bool bWasSimulatingPhysics = false;
 };
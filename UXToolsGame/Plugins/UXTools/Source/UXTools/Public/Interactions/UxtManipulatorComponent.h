@@ -11,6 +11,15 @@
 
 #include "UxtManipulatorComponent.generated.h"
 
+/** Constraints that apply to one combination of transform mode, hand count and interaction mode. */
+struct FUxtConstraintBucket
+{
+	TArray<UUxtTransformConstraint*> Constraints;
+
+	/** True if any of the constraints reads the head pose. */
+	bool bUsesHeadPose = false;
+};
+
 /**
  * Manages constraints that can be applied by child components.
  */
@@ -92,6 +101,12 @@ private:
 	/** Update the list registed constraints to be applied. */
 	void UpdateActiveConstraints();
 
+	/** Sort the active constraints into buckets, so that applying them doesn't need to filter them. */
+	void CompileConstraintBuckets();
+
+	/** Fetch the head pose for all active constraints that use it, once per frame. */
+	void UpdateConstraintHeadPose() const;
+
 	/** Converts @ref MinScale and @ref MaxScale between relative/absolute, based on the value of @ref bRelativeToInitialScale. */
 	void ConvertMinMaxScaleValues();
 
@@ -128,6 +143,15 @@ private:
 	/** The list constraints currently being applied. */
 	TArray<UUxtTransformConstraint*> ActiveConstraints;
 
+	/** Active constraints by transform mode, hand count and interaction mode. See @ref CompileConstraintBuckets. */
+	FUxtConstraintBucket ConstraintBuckets[12];
+
+	/** Active constraints that read the head pose. */
+	TArray<UUxtTransformConstraint*> HeadPoseConstraints;
+
+	/** Frame in which the head pose was last passed to @ref HeadPoseConstraints. */
+	mutable uint64 HeadPoseFrame = 0;
+
 	/** The component to use for a reference transform when initializing constraints. */
 	USceneComponent* TargetComponent = nullptr;
 
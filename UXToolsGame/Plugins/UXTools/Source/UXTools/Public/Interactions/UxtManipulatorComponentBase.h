@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 
 #include "Interactions/UxtGrabTargetComponent.h"
+#include "Utils/UxtOneEuroFilter.h"
 
 #include "UxtManipulatorComponentBase.generated.h"
 
@@ -63,6 +64,17 @@ public:
 		const FTransform& SourceTransform, float LocationLerpTime, float RotationLerpTime, float DeltaSeconds,
 		FTransform& TargetTransform) const;
 
+	/**
+	 * Apply an adaptive low-pass filter to the source transform location and rotation.
+	 * Slow movements are smoothed strongly to remove jitter while fast movements follow with little lag.
+	 * Location speed is measured in units per second, rotation speed in radians per second.
+	 * The filter starts from the current component transform when manipulation starts.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Uxt Manipulator Component Base")
+	void AdaptiveSmoothTransform(
+		const FTransform& SourceTransform, const FUxtOneEuroFilterSettings& LocationSettings,
+		const FUxtOneEuroFilterSettings& RotationSettings, float DeltaSeconds, FTransform& TargetTransform);
+
 	/**
 	 * Cache the initial world space and camera space transform.
 	 * Manipulation should be based on these initial transform for stable results.
@@ -99,6 +111,10 @@ private:
 
 	void UpdateManipulationLogic(int NumGrabPointers);
 
+	/** Filter state used by AdaptiveSmoothTransform. */
+	FUxtOneEuroVectorFilter LocationFilter;
+	FUxtOneEuroQuatFilter RotationFilter;
+
 public:
 	UPROPERTY(BlueprintAssignable, Category = "Uxt Manipulator Component Base")
 	FUxtUpdateTransformDelegate OnUpdateTransform;
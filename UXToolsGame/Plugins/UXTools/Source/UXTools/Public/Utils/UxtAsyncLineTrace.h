@@ -0,0 +1,41 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CollisionQueryParams.h"
+#include "EngineDefines.h"
+#include "WorldCollision.h"
+
+#include "Engine/EngineTypes.h"
+
+class UWorld;
+
+/**
+ * Line trace that can be queued to run asynchronously, in which case its result is consumed in the next frame.
+ *
+ * Async traces are batched by the world and run off the game thread, which removes their cost from the critical path
+ * at the cost of one frame of latency. Callers can hide that latency by queueing a segment extrapolated to the next frame.
+ */
+class UXTOOLS_API FUxtAsyncLineTrace
+{
+public:
+	/** Trace the segment synchronously, discarding any queued trace. Returns true if there was a blocking hit. */
+	bool Trace(
+		UWorld* World, FHitResult& OutHit, const FVector& Start, const FVector& End, ECollisionChannel TraceChannel,
+		const FCollisionQueryParams& QueryParams);
+
+	/**
+	 * Return the hit of the segment queued in the previous frame and queue QueueStart-QueueEnd for the next one.
+	 * Falls back to a synchronous trace of Start-End when no queued result is available, e.g. on the first frame.
+	 * Returns true if there was a blocking hit.
+	 */
+	bool TraceAsync(
+		UWorld* World, FHitResult& OutHit, const FVector& Start, const FVector& End, const FVector& QueueStart, const FVector& QueueEnd,
+		ECollisionChannel TraceChannel, const FCollisionQueryParams& QueryParams);
+
+private:
+	/** Handle of the trace queued in the last call to TraceAsync. */
+	FTraceHandle PendingTrace;
+};
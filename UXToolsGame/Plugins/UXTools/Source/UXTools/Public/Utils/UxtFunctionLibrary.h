@@ -20,7 +20,7 @@ class UXTOOLS_API UUxtFunctionLibrary : public UBlueprintFunctionLibrary
 	GENERATED_BODY()
 
 public:
-	/** Returns the world space position and orientation of the head. */
+	/** Returns the world space position and orientation of the head, as sampled for the current frame. */
 	UFUNCTION(BlueprintPure, Category = "UXTools", meta = (WorldContext = "WorldContextObject", UnsafeDuringActorConstruction = "true"))
 	static FTransform GetHeadPose(UObject* WorldContextObject);
 
@@ -40,6 +40,6 @@ public:
 	/** When true, the methods in this class will use test data. Intended for tests and internal usage only. */
 	static bool bUseTestData;
 
-	/** When bUseTestData is true, GetHeadPose will return this transform. */
+	/** When bUseTestData is true, GetHeadPose will return this transform unless the head pose subsystem has an override. */
 	static FTransform TestHeadPose;
 };
@@ -0,0 +1,87 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "UxtHeadPoseSubsystem.generated.h"
+
+/**
+ * World subsystem that samples the head pose once per frame.
+ *
+ * The pose is sampled before actors tick, in the same way the default hand tracker samples controller data, so that all
+ * components read a consistent head pose during the frame without querying the XR system repeatedly.
+ * Linear and angular velocities are estimated from consecutive samples.
+ * The sampled pose can be overridden, e.g. to replay a recorded session, in which case the override takes precedence over both the
+ * XR system and test data.
+ */
+UCLASS(ClassGroup = "UXTools")
+class UXTOOLS_API UUxtHeadPoseSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//
+	// USubsystem interface
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** World space head pose sampled this frame. */
+	UFUNCTION(BlueprintPure, Category = "UXTools|Head Pose")
+	FTransform GetHeadPose();
+
+	/** Head velocity in world space, in units per second. */
+	UFUNCTION(BlueprintPure, Category = "UXTools|Head Pose")
+	FVector GetLinearVelocity();
+
+	/** Head angular velocity in world space, as rotation axis scaled by radians per second. */
+	UFUNCTION(BlueprintPure, Category = "UXTools|Head Pose")
+	FVector GetAngularVelocity();
+
+	/** Use the given head pose in place of the XR system and test data until the override is cleared. Applies to the current frame. */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Head Pose")
+	void SetHeadPoseOverride(const FTransform& Pose);
+
+	/** Sample the head pose from the XR system or test data again. Applies to the current frame. */
+	UFUNCTION(BlueprintCallable, Category = "UXTools|Head Pose")
+	void ClearHeadPoseOverride();
+
+	/** True if the head pose is overridden. */
+	UFUNCTION(BlueprintPure, Category = "UXTools|Head Pose")
+	bool HasHeadPoseOverride() const;
+
+	/** Engine frame counter of the frame in which the head pose was last sampled. */
+	uint64 GetFrameId() const;
+
+	/** Sample the head pose if it has not been sampled in the current frame yet. */
+	void UpdateHeadPose();
+
+	/** Query the head pose from the XR system, bypassing the cached value. */
+	static FTransform QueryHeadPose(UObject* WorldContextObject);
+
+private:
+	void OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaTime);
+
+	/** Take a new sample of the head pose, even if it has already been sampled in the current frame. */
+	void SampleHeadPose();
+
+	FTransform HeadPose = FTransform::Identity;
+	FVector LinearVelocity = FVector::ZeroVector;
+	FVector AngularVelocity = FVector::ZeroVector;
+
+	/** World time of the last sample, used to estimate velocities. */
+	float SampleTime = 0.0f;
+
+	/** Frame counter of the last sample, INDEX_NONE if no sample has been taken yet. */
+	uint64 FrameId = static_cast<uint64>(INDEX_NONE);
+
+	/** Head pose used in place of the XR system and test data, if set. */
+	TOptional<FTransform> HeadPoseOverride;
+
+	FDelegateHandle TickDelegateHandle;
+};
@@ -0,0 +1,119 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "UxtOneEuroFilter.generated.h"
+
+/**
+ * Parameters of a One Euro filter.
+ *
+ * The cutoff frequency of the filter adapts to the speed of the signal: MinCutoff is used when the signal is at rest
+ * and Beta increases the cutoff as the signal speeds up. Slow movements are smoothed strongly while fast movements
+ * follow with little lag.
+ */
+USTRUCT(BlueprintType)
+struct UXTOOLS_API FUxtOneEuroFilterSettings
+{
+	GENERATED_BODY()
+
+	FUxtOneEuroFilterSettings() = default;
+	FUxtOneEuroFilterSettings(float InMinCutoff, float InBeta, float InDerivativeCutoff)
+		: MinCutoff(InMinCutoff), Beta(InBeta), DerivativeCutoff(InDerivativeCutoff)
+	{
+	}
+
+	/** Cutoff frequency in Hz when the signal is at rest. Lower values remove more jitter. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt One Euro Filter", meta = (ClampMin = "0.001"))
+	float MinCutoff = 1.0f;
+
+	/** Increase of the cutoff frequency per unit of signal speed. Higher values reduce lag during fast movements. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt One Euro Filter", meta = (ClampMin = "0.0"))
+	float Beta = 0.0f;
+
+	/** Cutoff frequency in Hz used to smooth the estimated signal speed. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Uxt One Euro Filter", meta = (ClampMin = "0.001"))
+	float DerivativeCutoff = 1.0f;
+};
+
+/**
+ * One Euro filter for a scalar signal.
+ *
+ * Each sample costs a fixed amount of work and no memory is allocated, so the filter can run every frame.
+ * The first sample after a reset is returned unfiltered.
+ */
+class UXTOOLS_API FUxtOneEuroFilter
+{
+public:
+	/** Clear the filter state. */
+	void Reset();
+
+	/** Set the filter state to the given value at rest. */
+	void Reset(float InitialValue);
+
+	/** True if the filter has received a sample since the last reset. */
+	bool HasValue() const { return bHasValue; }
+
+	/** Filter a new sample taken DeltaTime seconds after the previous one. */
+	float Filter(float Sample, float DeltaTime, const FUxtOneEuroFilterSettings& Settings);
+
+	/** Smoothing factor of an exponential low-pass filter with the given cutoff frequency. */
+	static float GetSmoothingFactor(float Cutoff, float DeltaTime);
+
+private:
+	float Value = 0.0f;
+	float Speed = 0.0f;
+	bool bHasValue = false;
+};
+
+/**
+ * One Euro filter for a vector signal.
+ *
+ * Each axis is filtered independently, so every axis adapts its cutoff to its own speed.
+ */
+class UXTOOLS_API FUxtOneEuroVectorFilter
+{
+public:
+	/** Clear the filter state. */
+	void Reset();
+
+	/** Set the filter state to the given value at rest. */
+	void Reset(const FVector& InitialValue);
+
+	/** True if the filter has received a sample since the last reset. */
+	bool HasValue() const { return AxisFilters[0].HasValue(); }
+
+	/** Filter a new sample taken DeltaTime seconds after the previous one. */
+	FVector Filter(const FVector& Sample, float DeltaTime, const FUxtOneEuroFilterSettings& Settings);
+
+private:
+	FUxtOneEuroFilter AxisFilters[3];
+};
+
+/**
+ * One Euro filter for rotations.
+ *
+ * The cutoff adapts to the angular speed in radians per second and the rotation is smoothed along the shortest arc.
+ */
+class UXTOOLS_API FUxtOneEuroQuatFilter
+{
+public:
+	/** Clear the filter state. */
+	void Reset();
+
+	/** Set the filter state to the given rotation at rest. */
+	void Reset(const FQuat& InitialValue);
+
+	/** True if the filter has received a sample since the last reset. */
+	bool HasValue() const { return bHasValue; }
+
+	/** Filter a new sample taken DeltaTime seconds after the previous one. */
+	FQuat Filter(const FQuat& Sample, float DeltaTime, const FUxtOneEuroFilterSettings& Settings);
+
+private:
+	FQuat Value = FQuat::Identity;
+	float AngularSpeed = 0.0f;
+	bool bHasValue = false;
+};
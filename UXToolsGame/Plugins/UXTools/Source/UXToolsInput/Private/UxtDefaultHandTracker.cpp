@@ -47,6 +47,19 @@ namespace
 		}
 		return false;
 	}
+
+	void UpdatePointerPredictor(const FUxtHandSnapshot& Snapshot, double Time, FUxtPosePredictor& Predictor)
+	{
+		// Velocities from before a tracking loss are meaningless once the hand is found again
+		if (Snapshot.bHasPointerPose)
+		{
+			Predictor.AddSample(Snapshot.PointerOrientation, Snapshot.PointerPosition, Time);
+		}
+		else
+		{
+			Predictor.Reset();
+		}
+	}
 } // namespace
 
 void FUxtDefaultHandTracker::RegisterInputMappings()
@@ -132,6 +145,17 @@ bool FUxtDefaultHandTracker::GetPointerPose(EControllerHand Hand, FQuat& OutOrie
 	return false;
 }
 
+bool FUxtDefaultHandTracker::GetPredictedPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	if (PredictionHorizon <= 0.0f || !GetControllerData(Hand).bValid)
+	{
+		return GetPointerPose(Hand, OutOrientation, OutPosition);
+	}
+
+	const FUxtPosePredictor& Predictor = Hand == EControllerHand::Left ? PointerPredictor_Left : PointerPredictor_Right;
+	return Predictor.Predict(PredictionHorizon, OutOrientation, OutPosition);
+}
+
 bool FUxtDefaultHandTracker::GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const
 {
 	const FXRMotionControllerData& MotionControllerData = GetControllerData(Hand);
@@ -171,3 +195,24 @@ bool FUxtDefaultHandTracker::GetIsSelectPressed(EControllerHand Hand, bool& OutI
 	}
 	return false;
 }
+
+const FUxtHandSnapshot& FUxtDefaultHandTracker::GetHandSnapshot(EControllerHand Hand) const
+{
+	return Hand == EControllerHand::Left ? HandSnapshot_Left : HandSnapshot_Right;
+}
+
+bool FUxtDefaultHandTracker::ReadPublishedHandSnapshot(EControllerHand Hand, FUxtHandSnapshot& OutSnapshot) const
+{
+	PublishedHandSnapshots.Read(Hand, OutSnapshot);
+	return true;
+}
+
+void FUxtDefaultHandTracker::UpdateHandSnapshots(double Time)
+{
+	HandSnapshot_Left.CopyFromMotionControllerData(ControllerData_Left);
+	HandSnapshot_Right.CopyFromMotionControllerData(ControllerData_Right);
+	PublishedHandSnapshots.Publish(HandSnapshot_Left, HandSnapshot_Right);
+
+	UpdatePointerPredictor(HandSnapshot_Left, Time, PointerPredictor_Left);
+	UpdatePointerPredictor(HandSnapshot_Right, Time, PointerPredictor_Right);
+}
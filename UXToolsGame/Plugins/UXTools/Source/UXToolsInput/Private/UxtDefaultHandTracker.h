@@ -6,6 +6,8 @@
 #include "HeadMountedDisplayTypes.h"
 
 #include "HandTracking/IUxtHandTracker.h"
+#include "HandTracking/UxtHandSnapshotBuffer.h"
+#include "HandTracking/UxtPosePredictor.h"
 
 class AXRSimulationActor;
 struct FXRSimulationState;
@@ -23,8 +25,10 @@ namespace UxtHandTrackerInputActions
  * This implementation works for all XR systems. It uses the XRTrackingSystem engine API.
  * Hand and controller data is based on the FXRMotionControllerData.
  *
- * Motion controller data is cached at the beginning of each frame.
+ * Motion controller data is cached at the beginning of each frame, along with a hand snapshot for each hand.
+ * Snapshots are also published through a lock-free buffer so they can be read from other threads.
  * Input events for known XR systems are used to keep track of Select and Grip actions.
+ * Pointer poses can be extrapolated to display time by a constant velocity predictor.
  */
 class FUxtDefaultHandTracker : public IUxtHandTracker
 {
@@ -43,17 +47,34 @@ public:
 	virtual bool GetJointState(
 		EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const override;
 	virtual bool GetPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
+	virtual bool GetPredictedPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
 	virtual bool GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
 	virtual bool GetIsGrabbing(EControllerHand Hand, bool& OutIsGrabbing) const override;
 	virtual bool GetIsSelectPressed(EControllerHand Hand, bool& OutIsSelectPressed) const override;
+	virtual const FUxtHandSnapshot& GetHandSnapshot(EControllerHand Hand) const override;
+	virtual bool ReadPublishedHandSnapshot(EControllerHand Hand, FUxtHandSnapshot& OutSnapshot) const override;
 
 private:
+	/**
+	 * Copy the cached motion controller data into the hand snapshots and publish them for other threads.
+	 * Pointer poses are added to the predictors as samples taken at the given time.
+	 */
+	void UpdateHandSnapshots(double Time);
+
 	FXRMotionControllerData ControllerData_Left;
 	FXRMotionControllerData ControllerData_Right;
 	bool bIsGrabbing_Left = false;
 	bool bIsSelectPressed_Left = false;
 	bool bIsGrabbing_Right = false;
 	bool bIsSelectPressed_Right = false;
+	FUxtHandSnapshot HandSnapshot_Left;
+	FUxtHandSnapshot HandSnapshot_Right;
+	FUxtHandSnapshotBuffer PublishedHandSnapshots;
+	FUxtPosePredictor PointerPredictor_Left;
+	FUxtPosePredictor PointerPredictor_Right;
+
+	/** Time in seconds by which predicted pointer poses are extrapolated, zero disables prediction. */
+	float PredictionHorizon = 0.0f;
 
 	friend class UUxtDefaultHandTrackerSubsystem;
 };
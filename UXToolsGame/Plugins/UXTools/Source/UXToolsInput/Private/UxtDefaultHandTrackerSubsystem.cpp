@@ -17,6 +17,7 @@
 #include "GameFramework/GameModeBase.h"
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/App.h"
 #include "Utils/UxtFunctionLibrary.h"
 
 void UUxtDefaultHandTrackerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -177,6 +178,9 @@ void UUxtDefaultHandTrackerSubsystem::OnWorldPreActorTick(UWorld* World, ELevelT
 		// Disable head pose override from simulation
 		UUxtFunctionLibrary::bUseTestData = false;
 	}
+	// Predicting further than a few frames ahead overshoots more than it helps
+	DefaultHandTracker.PredictionHorizon = FMath::Clamp(PointerPredictionHorizon, 0.0f, 0.1f);
+	DefaultHandTracker.UpdateHandSnapshots(FApp::GetCurrentTime());
 }
 
 void UUxtDefaultHandTrackerSubsystem::OnLeftSelectPressed()
@@ -19,7 +19,7 @@ class AGameModeBase;
  * It registers input action mappings and binds to input events for Select/Grip actions.
  * It also updates MotionControllerData of the default hand tracker once per world tick.
  */
-UCLASS()
+UCLASS(Config = Game)
 class UUxtDefaultHandTrackerSubsystem : public UEngineSubsystem
 {
 	GENERATED_BODY()
@@ -52,4 +52,11 @@ private:
 	FDelegateHandle LogoutHandle;
 
 	bool ShouldApplyGripPoseScale = false;
+
+	/**
+	 * Time in seconds by which predicted pointer poses are extrapolated to compensate for display latency.
+	 * Zero disables prediction.
+	 */
+	UPROPERTY(Config)
+	float PointerPredictionHorizon = 0.0f;
 };
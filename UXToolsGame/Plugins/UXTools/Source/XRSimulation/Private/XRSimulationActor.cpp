@@ -11,6 +11,7 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/Engine.h"
 #include "Engine/LocalPlayer.h"
+#include "Engine/SkeletalMesh.h"
 #include "GameFramework/InputSettings.h"
 #include "GameFramework/PlayerInput.h"
 #include "Kismet/GameplayStatics.h"
@@ -102,6 +103,27 @@ namespace
 
 		return Result;
 	}
+
+	/** Utility for building a static list of bone names matching the keypoint enum values. */
+	TArray<FName> BuildHandKeypointBoneNames()
+	{
+		const UEnum* KeypointEnum = StaticEnum<EHandKeypoint>();
+
+		TArray<FName> Result;
+		Result.SetNumUninitialized(EHandKeypointCount);
+		for (int32 iKeypoint = 0; iKeypoint < EHandKeypointCount; ++iKeypoint)
+		{
+			Result[iKeypoint] = FName(*KeypointEnum->GetNameStringByValue(iKeypoint));
+		}
+
+		return Result;
+	}
+
+	const TArray<FName>& GetHandKeypointBoneNames()
+	{
+		static const TArray<FName> KeypointBoneNames = BuildHandKeypointBoneNames();
+		return KeypointBoneNames;
+	}
 } // namespace
 
 AXRSimulationActor::AXRSimulationActor(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
@@ -187,21 +209,22 @@ void AXRSimulationActor::GetHandData(EControllerHand Hand, FXRMotionControllerDa
 
 	if (!bIsTracked)
 	{
-		// When untracked the keypoint arrays should be empty
-		MotionControllerData.HandKeyPositions.Empty();
-		MotionControllerData.HandKeyRotations.Empty();
-		MotionControllerData.HandKeyRadii.Empty();
+		// When untracked the keypoint arrays should be empty.
+		// Keep the allocation so the arrays can be refilled in place once tracking resumes.
+		MotionControllerData.HandKeyPositions.Reset();
+		MotionControllerData.HandKeyRotations.Reset();
+		MotionControllerData.HandKeyRadii.Reset();
 	}
 	else
 	{
-		MotionControllerData.HandKeyPositions.SetNum(EHandKeypointCount);
-		MotionControllerData.HandKeyRotations.SetNum(EHandKeypointCount);
-		MotionControllerData.HandKeyRadii.SetNum(EHandKeypointCount);
+		MotionControllerData.HandKeyPositions.SetNumUninitialized(EHandKeypointCount, false);
+		MotionControllerData.HandKeyRotations.SetNumUninitialized(EHandKeypointCount, false);
+		MotionControllerData.HandKeyRadii.SetNumUninitialized(EHandKeypointCount, false);
 
 		// Get keypoint transforms for all hand joints
 		static const TArray<EHandKeypoint> AllKeypoints = BuildHandKeypointList();
-		TArray<FTransform> AllKeypointTransforms;
-		TArray<float> AllKeypointRadii;
+		FTransform AllKeypointTransforms[EHandKeypointCount];
+		float AllKeypointRadii[EHandKeypointCount];
 		GetKeypointTransforms(Hand, AllKeypoints, AllKeypointTransforms, AllKeypointRadii);
 
 		for (int32 i = 0; i < EHandKeypointCount; ++i)
@@ -416,7 +439,42 @@ void AXRSimulationActor::UpdateHandMeshComponent(EControllerHand Hand)
 		{
 			HandMesh->SetVisibility(bVisible);
 		}
+
+		UpdateKeypointBoneIndices(Hand);
+	}
+}
+
+void AXRSimulationActor::UpdateKeypointBoneIndices(EControllerHand Hand)
+{
+	USkeletalMeshComponent* HandMesh = GetHandMesh(Hand);
+	if (!HandMesh || HasKeypointBoneIndices(Hand))
+	{
+		return;
+	}
+
+	FKeypointBoneIndices& KeypointBones = (Hand == EControllerHand::Left ? LeftKeypointBones : RightKeypointBones);
+	KeypointBones.SkeletalMesh = HandMesh->SkeletalMesh;
+	KeypointBones.NumBones = HandMesh->GetComponentSpaceTransforms().Num();
+
+	const TArray<FName>& KeypointBoneNames = GetHandKeypointBoneNames();
+	for (int32 iKeypoint = 0; iKeypoint < EHandKeypointCount; ++iKeypoint)
+	{
+		KeypointBones.BoneIndices[iKeypoint] = HandMesh->GetBoneIndex(KeypointBoneNames[iKeypoint]);
+	}
+}
+
+bool AXRSimulationActor::HasKeypointBoneIndices(EControllerHand Hand) const
+{
+	USkeletalMeshComponent* HandMesh = GetHandMesh(Hand);
+	if (!HandMesh || !HandMesh->SkeletalMesh)
+	{
+		return false;
 	}
+
+	// Bone transforms are reallocated when the mesh changes, indices into them are stale if the count differs
+	const FKeypointBoneIndices& KeypointBones = (Hand == EControllerHand::Left ? LeftKeypointBones : RightKeypointBones);
+	return KeypointBones.SkeletalMesh.Get() == HandMesh->SkeletalMesh &&
+		   KeypointBones.NumBones == HandMesh->GetComponentSpaceTransforms().Num();
 }
 
 void AXRSimulationActor::RegisterInputMappings()
@@ -555,28 +613,30 @@ void AXRSimulationActor::OnHandRotateReleased()
 }
 
 bool AXRSimulationActor::GetKeypointTransforms(
-	EControllerHand Hand, const TArray<EHandKeypoint>& Keypoints, TArray<FTransform>& OutTransforms, TArray<float>& OutRadii) const
+	EControllerHand Hand, TArrayView<const EHandKeypoint> Keypoints, TArrayView<FTransform> OutTransforms, TArrayView<float> OutRadii) const
 {
-	const UEnum* KeypointEnum = StaticEnum<EHandKeypoint>();
+	check(OutTransforms.Num() >= Keypoints.Num() && OutRadii.Num() >= Keypoints.Num());
+
 	USkeletalMeshComponent* MeshComp = GetHandMesh(Hand);
 	if (!ensureAsRuntimeWarning(MeshComp != nullptr))
 	{
 		return false;
 	}
 
-	TArray<FName> BoneNames;
-	MeshComp->GetBoneNames(BoneNames);
 	const TArray<FTransform>& ComponentSpaceTMs = MeshComp->GetComponentSpaceTransforms();
 
-	OutTransforms.Reset(Keypoints.Num());
-	OutRadii.Reset(Keypoints.Num());
-	for (EHandKeypoint Keypoint : Keypoints)
+	// Bone indices are built when the mesh is assigned, fall back to name lookup if the actor has not ticked since.
+	const FKeypointBoneIndices& KeypointBones = (Hand == EControllerHand::Left ? LeftKeypointBones : RightKeypointBones);
+	const bool bHasBoneIndices = HasKeypointBoneIndices(Hand);
+
+	for (int32 i = 0; i < Keypoints.Num(); ++i)
 	{
-		FName KeypointName = FName(*KeypointEnum->GetNameStringByValue((int64)Keypoint));
+		const int32 iKeypoint = (int32)Keypoints[i];
 
-		int32 KeypointPoseIndex;
-		FTransform KeypointTransform;
-		if (BoneNames.Find(KeypointName, KeypointPoseIndex))
+		FTransform& KeypointTransform = OutTransforms[i];
+		const int32 KeypointPoseIndex = bHasBoneIndices ? KeypointBones.BoneIndices[iKeypoint]
+														: MeshComp->GetBoneIndex(GetHandKeypointBoneNames()[iKeypoint]);
+		if (ComponentSpaceTMs.IsValidIndex(KeypointPoseIndex))
 		{
 			KeypointTransform = ComponentSpaceTMs[KeypointPoseIndex];
 		}
@@ -588,10 +648,7 @@ bool AXRSimulationActor::GetKeypointTransforms(
 		FTransform::Multiply(&KeypointTransform, &KeypointTransform, &MeshComp->GetComponentTransform());
 
 		// TODO What skeletal mesh property could be used for the radius?
-		float KeypointRadius = 1.0f;
-
-		OutTransforms.Add(KeypointTransform);
-		OutRadii.Add(KeypointRadius);
+		OutRadii[i] = 1.0f;
 	}
 
 	return true;
@@ -609,12 +666,13 @@ void AXRSimulationActor::UpdateStabilizedGripTransform(EControllerHand Hand)
 		if (bGrip && !bGripFrozen)
 		{
 			// Freeze grip transform
-			TArray<FTransform> KeypointTransforms;
-			TArray<float> KeypointRadii;
-			if (GetKeypointTransforms(Hand, {EHandKeypoint::Palm, EHandKeypoint::Wrist}, KeypointTransforms, KeypointRadii))
+			const EHandKeypoint Keypoints[] = {EHandKeypoint::Palm, EHandKeypoint::Wrist};
+			FTransform KeypointTransforms[UE_ARRAY_COUNT(Keypoints)];
+			float KeypointRadii[UE_ARRAY_COUNT(Keypoints)];
+			if (GetKeypointTransforms(Hand, Keypoints, KeypointTransforms, KeypointRadii))
 			{
-				const FTransform& PalmTransform = KeypointTransforms[(int32)EHandKeypoint::Palm];
-				const FTransform& WristTransform = KeypointTransforms[(int32)EHandKeypoint::Wrist];
+				const FTransform& PalmTransform = KeypointTransforms[0];
+				const FTransform& WristTransform = KeypointTransforms[1];
 				SimulationState->SetGripToWristTransform(Hand, PalmTransform.GetRelativeTransform(WristTransform));
 			}
 		}
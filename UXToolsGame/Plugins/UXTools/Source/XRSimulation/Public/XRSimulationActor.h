@@ -12,6 +12,7 @@
 #include "XRSimulationActor.generated.h"
 
 struct FXRMotionControllerData;
+class USkeletalMesh;
 class UXRSimulationHeadMovementComponent;
 
 /** Actor that produces head pose and hand animations for the simulated HMD. */
@@ -39,6 +40,9 @@ public:
 
 	void GetControllerActionState(EControllerHand Hand, bool& OutSelectPressed, bool& OutGripPressed) const;
 
+	/** True if keypoint bone indices are cached for the current mesh of the hand, otherwise keypoints are looked up by name. */
+	bool HasKeypointBoneIndices(EControllerHand Hand) const;
+
 	UFUNCTION(BlueprintGetter, Category = "XRSimulation")
 	UXRSimulationHeadMovementComponent* GetHeadMovement() const { return HeadMovement; }
 
@@ -52,9 +56,12 @@ public:
 	static void UnregisterInputMappings();
 
 private:
-	/** Find bone transforms matching the requested keypoints in the skeletal hand mesh. */
+	/** Find bone transforms matching the requested keypoints in the skeletal hand mesh.
+	 *  Output views must hold at least as many elements as the keypoint list.
+	 */
 	bool GetKeypointTransforms(
-		EControllerHand Hand, const TArray<EHandKeypoint>& Keypoints, TArray<FTransform>& OutTransforms, TArray<float>& OutRadii) const;
+		EControllerHand Hand, TArrayView<const EHandKeypoint> Keypoints, TArrayView<FTransform> OutTransforms,
+		TArrayView<float> OutRadii) const;
 
 	/** Set or clear the GripToWristTransform when grip starts or stops. */
 	void UpdateStabilizedGripTransform(EControllerHand Hand);
@@ -101,6 +108,9 @@ private:
 	/** Update hand mesh component based on simulation state */
 	void UpdateHandMeshComponent(EControllerHand Hand);
 
+	/** Rebuild the keypoint bone indices if the skeletal mesh of the hand has changed. */
+	void UpdateKeypointBoneIndices(EControllerHand Hand);
+
 public:
 	/** If true, adds default input bindings for input simulation. */
 	UPROPERTY(EditAnywhere, Category = "XRSimulation", BlueprintReadOnly)
@@ -126,4 +136,20 @@ private:
 	 * This transform is applied in parent space to the hand component transforms.
 	 */
 	FTransform TrackingToWorldTransform = FTransform::Identity;
+
+	/** Bone index of each keypoint in a hand mesh, so keypoint transforms can be gathered without name lookups. */
+	struct FKeypointBoneIndices
+	{
+		/** Skeletal mesh the indices were built for. */
+		TWeakObjectPtr<USkeletalMesh> SkeletalMesh;
+
+		/** Number of bone transforms of the mesh component when the indices were built. */
+		int32 NumBones = 0;
+
+		/** Bone index for each keypoint value, INDEX_NONE if the mesh has no matching bone. */
+		int32 BoneIndices[EHandKeypointCount];
+	};
+
+	FKeypointBoneIndices LeftKeypointBones;
+	FKeypointBoneIndices RightKeypointBones;
 };
@@ -8,7 +8,9 @@
 #include "UxtTestHandTracker.h"
 #include "UxtTestUtils.h"
 
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Controls/UxtBoundsControlComponent.h"
+#include "Controls/UxtBoundsControlSubsystem.h"
 #include "Input/UxtFarPointerComponent.h"
 #include "Input/UxtNearPointerComponent.h"
 #include "Interactions/Constraints/UxtMoveAxisConstraint.h"
@@ -23,7 +25,7 @@ namespace
 	const FVector TargetLocation(150, 0, 0);
 	const FVector InitialPointerOffset(0, 200, 0); // Offset to avoid pointing at the target before test starts
 
-	UUxtBoundsControlComponent* CreateTestComponent()
+	UUxtBoundsControlComponent* CreateTestComponent(bool bUseInstancedAffordanceRendering = false, bool bSetInstancedMaterial = true)
 	{
 		UWorld* World = UxtTestUtils::GetTestWorld();
 		AActor* Actor = World->SpawnActor<AActor>();
@@ -44,6 +46,13 @@ namespace
 		UUxtBoundsControlComponent* BoundsControl = NewObject<UUxtBoundsControlComponent>(Actor);
 		BoundsControl->Config =
 			Cast<UUxtBoundsControlConfig>(StaticLoadObject(UUxtBoundsControlConfig::StaticClass(), NULL, *BoundsControlPresetName));
+		BoundsControl->bUseInstancedAffordanceRendering = bUseInstancedAffordanceRendering;
+		// Most tests drive the bounds control without a pointer nearby, sleeping is tested explicitly
+		BoundsControl->bSleepWhenIdle = false;
+		if (bUseInstancedAffordanceRendering && bSetInstancedMaterial)
+		{
+			BoundsControl->InstancedAffordanceMaterial = UMaterial::GetDefaultMaterial(MD_Surface);
+		}
 		BoundsControl->RegisterComponent();
 
 		Actor->SetActorLocation(TargetLocation);
@@ -101,6 +110,8 @@ UBoundsControlTestComponent* EventCaptureComponent;
 
 // Data
 FTransform InitialActorTransform;
+FBox InitialBounds;
+UStaticMeshComponent* ChildMesh;
 FVector InitialAffordanceScale;
 EUxtInteractionMode InteractionMode = EUxtInteractionMode::None; // Cached to avoid passing it through all EnqueueX/lambdas
 
@@ -206,6 +217,207 @@ void BoundsControlSpec::Define()
 			FrameQueue.Enqueue([Done] { Done.Execute(); });
 		});
 	});
+
+	It("should render affordances with one instanced mesh per kind", [this] {
+		UUxtBoundsControlComponent* InstancedTarget = CreateTestComponent(true);
+
+		TSet<EUxtAffordanceKind> Kinds;
+		for (const auto& Entry : InstancedTarget->GetPrimitiveAffordanceMap())
+		{
+			Kinds.Add(Entry.Value.Config.GetAffordanceKind());
+			TestFalse("Affordance primitive is not rendered", Entry.Key->IsVisible());
+			TestNotEqual("Affordance has a render instance", Entry.Value.RenderInstanceIndex, (int32)INDEX_NONE);
+		}
+
+		TArray<UInstancedStaticMeshComponent*> InstancedMeshes;
+		InstancedTarget->GetBoundsControlActor()->GetComponents(InstancedMeshes);
+		TestEqual("One instanced mesh per affordance kind", InstancedMeshes.Num(), Kinds.Num());
+
+		int32 NumInstances = 0;
+		for (const UInstancedStaticMeshComponent* InstancedMesh : InstancedMeshes)
+		{
+			NumInstances += InstancedMesh->GetInstanceCount();
+		}
+		TestEqual("One instance per affordance", NumInstances, InstancedTarget->GetPrimitiveAffordanceMap().Num());
+
+		InstancedTarget->GetOwner()->Destroy();
+	});
+
+	It("should render affordances individually without an instanced affordance material", [this] {
+		AddExpectedError(TEXT("requires an instanced affordance material"), EAutomationExpectedErrorFlags::Contains, 1);
+		UUxtBoundsControlComponent* FallbackTarget = CreateTestComponent(true, false);
+
+		for (const auto& Entry : FallbackTarget->GetPrimitiveAffordanceMap())
+		{
+			TestTrue("Affordance primitive is rendered", Entry.Key->IsVisible());
+			TestEqual("Affordance has no render instance", Entry.Value.RenderInstanceIndex, (int32)INDEX_NONE);
+			TestNotNull("Affordance has a dynamic material", Entry.Value.DynamicMaterial);
+		}
+
+		TArray<UInstancedStaticMeshComponent*> InstancedMeshes;
+		FallbackTarget->GetBoundsControlActor()->GetComponents(InstancedMeshes);
+		TestEqual("No instanced meshes", InstancedMeshes.Num(), 0);
+
+		FallbackTarget->GetOwner()->Destroy();
+	});
+
+	LatentIt("should only mark instanced affordances dirty when they change", [this](const FDoneDelegate& Done) {
+		UUxtBoundsControlComponent* InstancedTarget = CreateTestComponent(true);
+
+		// First frames move instances from their initial transform, nothing changes afterwards while no pointer is near
+		FrameQueue.Skip(2);
+		FrameQueue.Enqueue([this, InstancedTarget] {
+			TestTrue("Bounds control is ticking", InstancedTarget->IsComponentTickEnabled());
+
+			TArray<UInstancedStaticMeshComponent*> InstancedMeshes;
+			InstancedTarget->GetBoundsControlActor()->GetComponents(InstancedMeshes);
+			TestTrue("Bounds control has instanced meshes", InstancedMeshes.Num() > 0);
+			for (const UInstancedStaticMeshComponent* InstancedMesh : InstancedMeshes)
+			{
+				TestFalse("Unchanged instanced mesh is dirty", InstancedMesh->IsRenderStateDirty());
+			}
+
+			InstancedTarget->GetOwner()->Destroy();
+		});
+		FrameQueue.Enqueue([Done] { Done.Execute(); });
+	});
+
+	Describe("Bounds control subsystem", [this] {
+		AfterEach([this] { LeftHand.Reset(); });
+
+		It("should sleep when idle by default",
+		   [this] { TestTrue("Sleeps when idle", GetDefault<UUxtBoundsControlComponent>()->bSleepWhenIdle); });
+
+		LatentIt("should only tick bounds controls near a pointer", [this](const FDoneDelegate& Done) {
+			Target->bSleepWhenIdle = true;
+
+			FrameQueue.Skip(2);
+			FrameQueue.Enqueue([this] {
+				const UUxtBoundsControlSubsystem* Subsystem = UxtTestUtils::GetTestWorld()->GetSubsystem<UUxtBoundsControlSubsystem>();
+				TestTrue("Bounds control is registered", Subsystem->GetNumBoundsControls() > 0);
+				TestFalse("Idle bounds control is not ticking", Target->IsComponentTickEnabled());
+
+				LeftHand.Configure(EUxtInteractionMode::Near, TargetPrimitive->GetComponentLocation());
+			});
+			FrameQueue.Skip();
+			FrameQueue.Enqueue([this] { TestTrue("Bounds control is ticking with a pointer nearby", Target->IsComponentTickEnabled()); });
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+
+		LatentIt("should not enable ticking that was disabled by the user", [this](const FDoneDelegate& Done) {
+			Target->SetComponentTickEnabled(false);
+			Target->bSleepWhenIdle = true;
+
+			FrameQueue.Skip(2);
+			FrameQueue.Enqueue([this] { LeftHand.Configure(EUxtInteractionMode::Near, TargetPrimitive->GetComponentLocation()); });
+			FrameQueue.Skip();
+			FrameQueue.Enqueue([this] { TestFalse("Bounds control is ticking with a pointer nearby", Target->IsComponentTickEnabled()); });
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+
+		LatentIt("should stay awake while the bounds hierarchy changes", [this](const FDoneDelegate& Done) {
+			FrameQueue.Enqueue([this] {
+				InitialBounds = Target->GetBounds();
+
+				ChildMesh = UxtTestUtils::CreateStaticMesh(Actor);
+				ChildMesh->SetupAttachment(Actor->GetRootComponent());
+				ChildMesh->SetRelativeLocation(FVector(0, 0, 100));
+				ChildMesh->RegisterComponent();
+			});
+			// Child is picked up by the tick of this frame, which must keep the bounds control awake
+			FrameQueue.Enqueue([this] { Target->bSleepWhenIdle = true; });
+			FrameQueue.Enqueue([this] {
+				TestTrue("Bounds control is ticking after a hierarchy change", Target->IsComponentTickEnabled());
+				TestTrue("Bounds include the new child", Target->GetBounds().Max.Z > InitialBounds.Max.Z);
+			});
+			FrameQueue.Enqueue([this] { TestFalse("Bounds control is ticking once settled", Target->IsComponentTickEnabled()); });
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+
+		LatentIt("should wake up with a pointer near a child outside the root bounds", [this](const FDoneDelegate& Done) {
+			ChildMesh = UxtTestUtils::CreateStaticMesh(Actor);
+			ChildMesh->SetupAttachment(Actor->GetRootComponent());
+			ChildMesh->SetRelativeLocation(FVector(0, 0, 500));
+			ChildMesh->RegisterComponent();
+			Target->ComputeBoundsFromComponents();
+			Target->bSleepWhenIdle = true;
+
+			FrameQueue.Skip(3);
+			FrameQueue.Enqueue([this] {
+				TestFalse("Idle bounds control is not ticking", Target->IsComponentTickEnabled());
+				LeftHand.Configure(EUxtInteractionMode::Near, ChildMesh->GetComponentLocation());
+			});
+			FrameQueue.Skip();
+			FrameQueue.Enqueue([this] { TestTrue("Bounds control is ticking with a pointer nearby", Target->IsComponentTickEnabled()); });
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+
+		LatentIt("should only attempt deferred affordance creation once", [this](const FDoneDelegate& Done) {
+			AActor* InvalidActor = UxtTestUtils::GetTestWorld()->SpawnActor<AActor>();
+			UStaticMeshComponent* Mesh = UxtTestUtils::CreateStaticMesh(InvalidActor);
+			InvalidActor->SetRootComponent(Mesh);
+			Mesh->RegisterComponent();
+
+			UUxtBoundsControlComponent* InvalidBoundsControl = NewObject<UUxtBoundsControlComponent>(InvalidActor);
+			InvalidBoundsControl->Config = nullptr;
+			InvalidBoundsControl->bDeferAffordanceCreation = true;
+			InvalidBoundsControl->RegisterComponent();
+			InvalidActor->SetActorLocation(TargetLocation + FVector(0, 0, 300));
+
+			AddExpectedError(TEXT("Config asset is invalid"), EAutomationExpectedErrorFlags::Contains, 1);
+
+			FrameQueue.Enqueue([this, InvalidActor] { LeftHand.Configure(EUxtInteractionMode::Near, InvalidActor->GetActorLocation()); });
+			FrameQueue.Skip(3);
+			FrameQueue.Enqueue([this, InvalidBoundsControl] {
+				TestNull("Bounds control actor", InvalidBoundsControl->GetBoundsControlActor());
+				InvalidBoundsControl->GetOwner()->Destroy();
+			});
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+	});
+
+	Describe("Incremental bounds update", [this] {
+		LatentIt("should recompute bounds when a child component is added or moved", [this](const FDoneDelegate& Done) {
+			FrameQueue.Enqueue([this] {
+				InitialBounds = Target->GetBounds();
+
+				ChildMesh = UxtTestUtils::CreateStaticMesh(Actor);
+				ChildMesh->SetupAttachment(Actor->GetRootComponent());
+				ChildMesh->SetRelativeLocation(FVector(0, 0, 100));
+				ChildMesh->RegisterComponent();
+			});
+			FrameQueue.Enqueue([this] {
+				TestTrue("Bounds include the new child", Target->GetBounds().Max.Z > InitialBounds.Max.Z);
+
+				ChildMesh->SetRelativeLocation(FVector(0, 0, 200));
+			});
+			FrameQueue.Enqueue([this] {
+				TestTrue("Bounds follow the moved child", Target->GetBounds().Max.Z > InitialBounds.Max.Z + 150);
+
+				ChildMesh->DestroyComponent();
+			});
+			FrameQueue.Enqueue([this] {
+				TestEqual("Bounds shrink after removing the child", Target->GetBounds().Max, InitialBounds.Max);
+				TestEqual("Bounds shrink after removing the child", Target->GetBounds().Min, InitialBounds.Min);
+			});
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+
+		LatentIt("should keep local bounds when the actor is moved", [this](const FDoneDelegate& Done) {
+			FrameQueue.Enqueue([this] {
+				InitialBounds = Target->GetBounds();
+				Actor->SetActorLocation(TargetLocation + FVector(0, 50, 0));
+			});
+			FrameQueue.Enqueue([this] {
+				TestEqual("Local bounds are unchanged", Target->GetBounds().Max, InitialBounds.Max);
+				TestEqual("Local bounds are unchanged", Target->GetBounds().Min, InitialBounds.Min);
+				TestEqual(
+					"Bounds control actor follows the target", Target->GetBoundsControlActor()->GetActorLocation(),
+					Actor->GetActorLocation());
+			});
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+	});
 }
 
 void BoundsControlSpec::SetupEventCaptureComponent(UUxtGrabTargetComponent* GrabTarget)
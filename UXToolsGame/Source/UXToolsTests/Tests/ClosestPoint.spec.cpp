@@ -0,0 +1,184 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "UxtTestUtils.h"
+
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/SphereComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Controls/UxtTouchableVolumeComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Interactions/UxtPokeTarget.h"
+#include "Math/RandomStream.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const int32 NumSamplePoints = 200;
+
+	/** Tolerance for the physics engine's distance query, which is solved iteratively. */
+	const float PhysicsTolerance = 0.1f;
+
+	const FTransform PrimitiveTransform(FRotator(30, 45, -20), FVector(150, -20, 40));
+
+	/** Number of bones of the hand mesh that get a collision body, so the mesh has multiple bodies away from the root. */
+	const int32 NumSkeletalBodies = 6;
+
+	/** Build a transient physics asset with alternating box and sphere bodies on the first bones of the mesh. */
+	UPhysicsAsset* CreateHandPhysicsAsset(const USkeletalMesh* SkeletalMesh)
+	{
+		UPhysicsAsset* PhysicsAsset = NewObject<UPhysicsAsset>();
+		const FReferenceSkeleton& RefSkeleton = SkeletalMesh->RefSkeleton;
+		for (int32 BoneIndex = 0; BoneIndex < FMath::Min(NumSkeletalBodies, RefSkeleton.GetNum()); ++BoneIndex)
+		{
+			USkeletalBodySetup* BodySetup = NewObject<USkeletalBodySetup>(PhysicsAsset);
+			BodySetup->BoneName = RefSkeleton.GetBoneName(BoneIndex);
+			if (BoneIndex % 2 == 0)
+			{
+				BodySetup->AggGeom.BoxElems.Add(FKBoxElem(2.0f, 3.0f, 1.5f));
+			}
+			else
+			{
+				BodySetup->AggGeom.SphereElems.Add(FKSphereElem(1.5f));
+			}
+			PhysicsAsset->SkeletalBodySetups.Add(BodySetup);
+		}
+		PhysicsAsset->UpdateBodySetupIndexMap();
+		PhysicsAsset->UpdateBoundsBodiesArray();
+		return PhysicsAsset;
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	ClosestPointSpec, "UXTools.ClosestPoint",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext)
+
+/** Register the primitive as the actor root, along with the touchable volume that finds closest points through the default utility. */
+void AddPrimitive(UPrimitiveComponent* Primitive, const FVector& Scale);
+
+/** Compare the closest points of the touchable volume against the physics engine's distance query around the primitive. */
+void TestClosestPoints(UPrimitiveComponent* Primitive);
+
+AActor* Actor = nullptr;
+UUxtTouchableVolumeComponent* Volume = nullptr;
+
+END_DEFINE_SPEC(ClosestPointSpec)
+
+void ClosestPointSpec::AddPrimitive(UPrimitiveComponent* Primitive, const FVector& Scale)
+{
+	Primitive->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	Actor->SetRootComponent(Primitive);
+	Primitive->RegisterComponent();
+	Primitive->SetWorldTransform(FTransform(PrimitiveTransform.GetRotation(), PrimitiveTransform.GetLocation(), Scale));
+	Volume->RegisterComponent();
+}
+
+void ClosestPointSpec::TestClosestPoints(UPrimitiveComponent* Primitive)
+{
+	FRandomStream RandomStream(7);
+	const FBox SampleBox = Primitive->Bounds.GetBox().ExpandBy(20.0f);
+
+	for (int32 Index = 0; Index < NumSamplePoints; ++Index)
+	{
+		const FVector Point = RandomStream.RandPointInBox(SampleBox);
+
+		FVector ExpectedPoint;
+		float ExpectedDistanceSqr;
+		TestTrue("Physics query succeeded", Primitive->GetSquaredDistanceToCollision(Point, ExpectedDistanceSqr, ExpectedPoint));
+
+		FVector ClosestPoint;
+		FVector Normal;
+		TestTrue("Closest point found", IUxtPokeTarget::Execute_GetClosestPoint(Volume, Primitive, Point, ClosestPoint, Normal));
+
+		if (!ClosestPoint.Equals(ExpectedPoint, PhysicsTolerance))
+		{
+			AddError(FString::Printf(
+				TEXT("Closest point to %s is %s, physics query found %s"), *Point.ToString(), *ClosestPoint.ToString(),
+				*ExpectedPoint.ToString()));
+		}
+	}
+}
+
+void ClosestPointSpec::Define()
+{
+	Describe("Default closest point", [this] {
+		BeforeEach([this] {
+			TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+
+			Actor = UxtTestUtils::GetTestWorld()->SpawnActor<AActor>();
+			Volume = NewObject<UUxtTouchableVolumeComponent>(Actor);
+		});
+
+		AfterEach([this] {
+			Actor->Destroy();
+			Actor = nullptr;
+			Volume = nullptr;
+		});
+
+		It("should match the physics query on a box", [this] {
+			UBoxComponent* Box = NewObject<UBoxComponent>(Actor);
+			Box->SetBoxExtent(FVector(10, 20, 5));
+			AddPrimitive(Box, FVector(1.5f, 0.5f, 2.0f));
+
+			TestClosestPoints(Box);
+		});
+
+		It("should match the physics query on a sphere", [this] {
+			USphereComponent* Sphere = NewObject<USphereComponent>(Actor);
+			Sphere->SetSphereRadius(15.0f);
+			AddPrimitive(Sphere, FVector(2.0f));
+
+			TestClosestPoints(Sphere);
+		});
+
+		It("should match the physics query on a capsule", [this] {
+			UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(Actor);
+			Capsule->SetCapsuleSize(8.0f, 25.0f);
+			AddPrimitive(Capsule, FVector(1.5f));
+
+			TestClosestPoints(Capsule);
+		});
+
+		It("should match the physics query on a static mesh box", [this] {
+			UStaticMeshComponent* Mesh = UxtTestUtils::CreateStaticMesh(Actor);
+			AddPrimitive(Mesh, FVector(0.3f, 0.1f, 0.2f));
+
+			TestClosestPoints(Mesh);
+		});
+
+		It("should match the physics query on a static mesh sphere", [this] {
+			UStaticMeshComponent* Mesh =
+				UxtTestUtils::CreateStaticMesh(Actor, FVector::OneVector, TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+			AddPrimitive(Mesh, FVector(0.25f));
+
+			TestClosestPoints(Mesh);
+		});
+
+		It("should match the physics query on a skeletal mesh with multiple bodies", [this] {
+			USkeletalMesh* SkeletalMesh = LoadObject<USkeletalMesh>(nullptr, TEXT("/UXTools/XRSimulation/SK_Hand"));
+			if (!TestNotNull("Hand mesh loaded", SkeletalMesh))
+			{
+				return;
+			}
+
+			USkeletalMeshComponent* Mesh = NewObject<USkeletalMeshComponent>(Actor);
+			Mesh->SetSkeletalMesh(SkeletalMesh);
+			Mesh->SetPhysicsAsset(CreateHandPhysicsAsset(SkeletalMesh));
+			AddPrimitive(Mesh, FVector(1.5f));
+
+			TestTrue("Mesh has multiple bodies", Mesh->Bodies.Num() > 1);
+			TestClosestPoints(Mesh);
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
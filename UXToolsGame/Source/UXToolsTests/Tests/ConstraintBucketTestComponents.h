@@ -0,0 +1,66 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Interactions/Constraints/UxtTransformConstraint.h"
+#include "Interactions/UxtManipulatorComponent.h"
+
+#include "ConstraintBucketTestComponents.generated.h"
+
+/**
+ * Manipulator that exposes constraint initialization and application to tests.
+ */
+UCLASS(ClassGroup = "UXToolsTests")
+class UConstraintBucketTestManipulator : public UUxtManipulatorComponent
+{
+	GENERATED_BODY()
+
+public:
+	void InitializeTestConstraints(USceneComponent* NewTargetComponent) { InitializeConstraints(NewTargetComponent); }
+
+	void ApplyTestConstraints(FTransform& Transform, EUxtTransformMode TransformMode, bool bIsOneHanded, bool bIsNear) const
+	{
+		ApplyConstraints(Transform, TransformMode, bIsOneHanded, bIsNear);
+	}
+
+	virtual void OnExternalManipulationStarted() override {}
+};
+
+/**
+ * Constraint that records when it is applied and which head pose it was given.
+ */
+UCLASS(ClassGroup = "UXToolsTests")
+class UConstraintBucketTestConstraint : public UUxtTransformConstraint
+{
+	GENERATED_BODY()
+
+public:
+	virtual EUxtTransformMode GetConstraintType() const override { return ConstraintType; }
+
+	virtual void ApplyConstraint(FTransform& Transform) const override
+	{
+		if (ApplyLog)
+		{
+			ApplyLog->Add(this);
+		}
+		if (bUsesHeadPose)
+		{
+			LastHeadPose = GetHeadPose();
+		}
+	}
+
+	virtual bool UsesHeadPose() const override { return bUsesHeadPose; }
+
+public:
+	EUxtTransformMode ConstraintType = EUxtTransformMode::Translation;
+	bool bUsesHeadPose = false;
+
+	/** Constraints append themselves to this list when applied. */
+	TArray<const UConstraintBucketTestConstraint*>* ApplyLog = nullptr;
+
+	/** Head pose seen by the last ApplyConstraint call. */
+	mutable FTransform LastHeadPose;
+};
@@ -90,6 +90,26 @@ void FFarBeamSpec::Define()
 
 			FrameQueue.Enqueue([Done] { Done.Execute(); });
 		});
+
+		LatentIt("should start at the predicted ray while the far pointer uses the raw pose", [this](const FDoneDelegate& Done) {
+			const FVector PredictedOffset(0, 0, 10);
+			UxtTestUtils::GetTestHandTracker().SetPredictedPointerOffset(PredictedOffset);
+
+			FrameQueue.Enqueue([this] { UxtTestUtils::GetTestHandTracker().SetAllJointPositions(FVector::ZeroVector); });
+			FrameQueue.Skip(2);
+			FrameQueue.Enqueue([this, PredictedOffset] {
+				UUxtFarPointerComponent* FarPointer = HandInteractionActor->FindComponentByClass<UUxtFarPointerComponent>();
+				TestTrue(TEXT("Far pointer and beam are not null"), FarPointer != nullptr && Beam != nullptr);
+				if (FarPointer && Beam)
+				{
+					TestEqual(TEXT("Pointer origin is not predicted"), FarPointer->GetPointerOrigin(), FVector::ZeroVector);
+					TestEqual(TEXT("Predicted pointer origin"), FarPointer->GetPredictedPointerOrigin(), PredictedOffset);
+					TestEqual(TEXT("Beam starts at the predicted ray start"), Beam->GetStartPosition(), FarPointer->GetPredictedRayStart());
+				}
+			});
+
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
 	});
 }
 
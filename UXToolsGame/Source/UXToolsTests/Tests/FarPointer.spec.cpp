@@ -12,6 +12,7 @@
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Input/UxtFarPointerComponent.h"
+#include "Input/UxtInputSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Misc/AutomationTest.h"
 #include "Tests/AutomationCommon.h"
@@ -107,6 +108,53 @@ void FFarPointerSpec::Define()
 		TestEqual("Object is targeted", FocusTarget, FarTarget);
 	});
 
+	LatentIt("should use async trace results in the next frame", [this](const FDoneDelegate& Done) {
+		Pointer->bAsyncTrace = true;
+		Pointer->bCompensateTraceLatency = false;
+
+		FrameQueue.Enqueue([this]() {
+			TestEqual("Target is hit by the synchronous fallback", Pointer->GetHitPrimitive(), HitPrimitive);
+			HandTracker->SetAllJointPositions(FVector(-500, 0, 0));
+		});
+
+		FrameQueue.Enqueue([this]() {
+			TestEqual("Trace queued in the previous frame is used", Pointer->GetHitPrimitive(), HitPrimitive);
+		});
+
+		FrameQueue.Enqueue([this, Done]() {
+			TestNull("No hit once the queued trace misses", Pointer->GetHitPrimitive());
+			Done.Execute();
+		});
+	});
+
+	LatentIt("should compensate async trace latency with the pointer velocity", [this](const FDoneDelegate& Done) {
+		Pointer->bAsyncTrace = true;
+		Pointer->bCompensateTraceLatency = true;
+
+		// The trace is extrapolated by the velocity times the last frame time, which is the last change in position
+		FrameQueue.Enqueue([this]() { HandTracker->SetAllJointPositions(FVector(0, 10, 0)); });
+
+		FrameQueue.Enqueue([this]() {
+			TestEqual("Trace is extrapolated by the pointer velocity", Pointer->GetAsyncTracePose().GetLocation(), FVector(0, 20, 0));
+			HandTracker->SetTracked(false);
+		});
+
+		FrameQueue.Enqueue([this]() {
+			HandTracker->SetTracked(true);
+			HandTracker->SetAllJointPositions(FVector(0, 100, 0));
+		});
+
+		FrameQueue.Enqueue([this]() {
+			TestEqual("Velocity is zero after tracking is regained", Pointer->GetAsyncTracePose().GetLocation(), FVector(0, 100, 0));
+			HandTracker->SetAllJointPositions(FVector(0, 110, 0));
+		});
+
+		FrameQueue.Enqueue([this, Done]() {
+			TestEqual("Velocity is estimated once tracked twice", Pointer->GetAsyncTracePose().GetLocation(), FVector(0, 120, 0));
+			Done.Execute();
+		});
+	});
+
 	LatentIt("should raise the correct events on far targets", [this](const FDoneDelegate& Done) {
 		// We expect the pointer to be focusing the target from the first frame
 		TestEqual("EnterFarFocus", FarTarget->NumEnter, 1);
@@ -152,6 +200,22 @@ void FFarPointerSpec::Define()
 		});
 	});
 
+	It("should cache far targets until invalidated", [this]() {
+		TestTrue("Far target", UUxtInputSubsystem::GetFarTarget(HitPrimitive) == FarTarget);
+
+		FarTarget->bIsFarFocusable = false;
+		TestTrue("Far target is cached", UUxtInputSubsystem::GetFarTarget(HitPrimitive) == FarTarget);
+
+		UUxtInputSubsystem::InvalidateFarTargets(FarTarget->GetOwner());
+		TestNull("Far target after invalidation", UUxtInputSubsystem::GetFarTarget(HitPrimitive));
+
+		// Adding a component to the actor also discards the cached far targets
+		FarTarget->bIsFarFocusable = true;
+		UFarTargetTestComponent* OtherTarget = NewObject<UFarTargetTestComponent>(FarTarget->GetOwner());
+		OtherTarget->RegisterComponent();
+		TestNotNull("Far target after adding a component", UUxtInputSubsystem::GetFarTarget(HitPrimitive));
+	});
+
 	It("should use hand transform", [this]() {
 		FQuat Orientation;
 		FVector Position;
@@ -7,6 +7,7 @@
 
 #include "Components/ActorComponent.h"
 #include "Input/UxtFarPointerComponent.h"
+#include "Input/UxtInputSubsystem.h"
 #include "Interactions/UxtFarHandler.h"
 #include "Interactions/UxtFarTarget.h"
 
@@ -22,33 +23,77 @@ class UXTOOLSTESTS_API UFarTargetTestComponent
 	GENERATED_BODY()
 
 public:
+	//
+	// UActorComponent interface
+
+	virtual void OnRegister() override
+	{
+		Super::OnRegister();
+		UUxtInputSubsystem::RegisterInterfaceComponent(this);
+	}
+
+	virtual void OnUnregister() override
+	{
+		UUxtInputSubsystem::UnregisterInterfaceComponent(this);
+		Super::OnUnregister();
+	}
+
 	//
 	// IUxtFarTarget interface
 
-	virtual bool IsFarFocusable_Implementation(const UPrimitiveComponent* Primitive) const override { return true; }
+	virtual bool IsFarFocusable_Implementation(const UPrimitiveComponent* Primitive) const override { return bIsFarFocusable; }
 
 	//
 	// IUxtFarHandler interface
 
 	virtual bool CanHandleFar_Implementation(UPrimitiveComponent* Primitive) const override { return true; }
 
-	virtual void OnEnterFarFocus_Implementation(UUxtFarPointerComponent* Pointer) override { NumEnter++; }
-
-	virtual void OnUpdatedFarFocus_Implementation(UUxtFarPointerComponent* Pointer) override { NumUpdated++; }
-
-	virtual void OnExitFarFocus_Implementation(UUxtFarPointerComponent* Pointer) override { NumExit++; }
-
-	virtual void OnFarPressed_Implementation(UUxtFarPointerComponent* Pointer) override { NumPressed++; }
-
-	virtual void OnFarDragged_Implementation(UUxtFarPointerComponent* Pointer) override { NumDragged++; }
-
-	virtual void OnFarReleased_Implementation(UUxtFarPointerComponent* Pointer) override { NumReleased++; }
+	virtual void OnEnterFarFocus_Implementation(UUxtFarPointerComponent* Pointer) override
+	{
+		NumEnter++;
+		Events.Add(EUxtInputEventType::EnterFarFocus);
+	}
+
+	virtual void OnUpdatedFarFocus_Implementation(UUxtFarPointerComponent* Pointer) override
+	{
+		NumUpdated++;
+		Events.Add(EUxtInputEventType::UpdatedFarFocus);
+	}
+
+	virtual void OnExitFarFocus_Implementation(UUxtFarPointerComponent* Pointer) override
+	{
+		NumExit++;
+		Events.Add(EUxtInputEventType::ExitFarFocus);
+	}
+
+	virtual void OnFarPressed_Implementation(UUxtFarPointerComponent* Pointer) override
+	{
+		NumPressed++;
+		Events.Add(EUxtInputEventType::FarPressed);
+	}
+
+	virtual void OnFarDragged_Implementation(UUxtFarPointerComponent* Pointer) override
+	{
+		NumDragged++;
+		Events.Add(EUxtInputEventType::FarDragged);
+	}
+
+	virtual void OnFarReleased_Implementation(UUxtFarPointerComponent* Pointer) override
+	{
+		NumReleased++;
+		Events.Add(EUxtInputEventType::FarReleased);
+	}
 
 public:
+	bool bIsFarFocusable = true;
+
 	int NumEnter = 0;
 	int NumUpdated = 0;
 	int NumExit = 0;
 	int NumPressed = 0;
 	int NumDragged = 0;
 	int NumReleased = 0;
+
+	/** All events received, in order. */
+	TArray<EUxtInputEventType> Events;
 };
@@ -0,0 +1,86 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "UxtTestUtils.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Input/UxtFrontFacePokeGeometry.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+	FrontFacePokeGeometrySpec, "UXTools.FrontFacePokeGeometry",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext)
+
+AActor* Actor = nullptr;
+UStaticMeshComponent* Primitive = nullptr;
+FUxtFrontFacePokeGeometry Geometry;
+
+END_DEFINE_SPEC(FrontFacePokeGeometrySpec)
+
+void FrontFacePokeGeometrySpec::Define()
+{
+	BeforeEach([this] {
+		TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+
+		Actor = UxtTestUtils::GetTestWorld()->SpawnActor<AActor>();
+		Primitive = UxtTestUtils::CreateStaticMesh(Actor);
+		Actor->SetRootComponent(Primitive);
+		Primitive->RegisterComponent();
+
+		Geometry = FUxtFrontFacePokeGeometry();
+		TestTrue("Geometry is built", Geometry.Update(Primitive));
+	});
+
+	AfterEach([this] {
+		Actor->Destroy();
+		Actor = nullptr;
+		Primitive = nullptr;
+	});
+
+	It("should not rebuild while the primitive is unchanged", [this] {
+		TestFalse("Geometry is reused", Geometry.Update(Primitive));
+		TestTrue("Cube collision is a box", Geometry.bIsBoxShape);
+	});
+
+	It("should rebuild when the primitive moves", [this] {
+		Primitive->SetWorldLocation(FVector(100, 0, 0));
+
+		TestTrue("Geometry is rebuilt", Geometry.Update(Primitive));
+		TestEqual(
+			"Inverse transform uses the new location", Geometry.InverseTransform.TransformPosition(FVector(100, 0, 0)), FVector::ZeroVector);
+		TestFalse("Geometry is reused after the move", Geometry.Update(Primitive));
+	});
+
+	It("should rebuild when the primitive is rescaled", [this] {
+		const FVector OldScaledExtent = Geometry.ScaledExtent;
+		Primitive->SetWorldScale3D(FVector(2.0f));
+
+		TestTrue("Geometry is rebuilt", Geometry.Update(Primitive));
+		TestEqual("Scaled extent uses the new scale", Geometry.ScaledExtent, OldScaledExtent * 2.0f);
+		TestEqual("Scale along X", Geometry.ScaleX, 2.0f);
+	});
+
+	It("should rebuild when the body setup changes", [this] {
+		Primitive->SetStaticMesh(LoadObject<UStaticMesh>(Actor, TEXT("/Engine/BasicShapes/Sphere.Sphere")));
+
+		TestTrue("Geometry is rebuilt", Geometry.Update(Primitive));
+		TestFalse("Sphere collision is not a box", Geometry.bIsBoxShape);
+	});
+
+	It("should rebuild for another primitive", [this] {
+		UStaticMeshComponent* OtherPrimitive = UxtTestUtils::CreateStaticMesh(Actor, FVector(3.0f));
+		OtherPrimitive->SetupAttachment(Primitive);
+		OtherPrimitive->RegisterComponent();
+
+		TestTrue("Geometry is rebuilt", Geometry.Update(OtherPrimitive));
+		TestEqual("Scale along X", Geometry.ScaleX, 3.0f);
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,169 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "UxtTestHandTracker.h"
+
+#include "HandTracking/IUxtHandTracker.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const FVector LeftPosition(10, 20, 30);
+	const FVector RightPosition(-10, 20, 30);
+	const FQuat LeftOrientation(FRotator(0, 90, 0));
+	const FQuat RightOrientation(FRotator(0, -90, 0));
+
+	/** Test tracker that provides a pointer pose but no grip pose. */
+	class FPointerOnlyHandTracker : public FUxtTestHandTracker
+	{
+	public:
+		virtual bool GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override { return false; }
+	};
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	HandSnapshotSpec, "UXTools.HandTracking.Snapshot",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext)
+
+/** Compare every joint and pose of the snapshot against the individual getters of the tracker. */
+void TestMatchesGetters(const FUxtHandSnapshot& Snapshot, EControllerHand Hand);
+
+FUxtTestHandTracker HandTracker;
+
+END_DEFINE_SPEC(HandSnapshotSpec)
+
+void HandSnapshotSpec::TestMatchesGetters(const FUxtHandSnapshot& Snapshot, EControllerHand Hand)
+{
+	TestTrue("Tracking status", Snapshot.TrackingStatus == HandTracker.GetTrackingStatus(Hand));
+	TestTrue("Frame", Snapshot.FrameId == GFrameCounter);
+
+	for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+	{
+		FQuat ExpectedOrientation, Orientation;
+		FVector ExpectedPosition, Position;
+		float ExpectedRadius, Radius;
+		const bool bExpectedTracked =
+			HandTracker.GetJointState(Hand, (EHandKeypoint)Joint, ExpectedOrientation, ExpectedPosition, ExpectedRadius);
+		TestTrue("Joint is tracked", Snapshot.GetJointState((EHandKeypoint)Joint, Orientation, Position, Radius) == bExpectedTracked);
+
+		if (bExpectedTracked)
+		{
+			TestTrue("Joint orientation", Orientation.Equals(ExpectedOrientation));
+			TestEqual("Joint position", Position, ExpectedPosition);
+			TestEqual("Joint radius", Radius, ExpectedRadius);
+		}
+	}
+
+	FQuat ExpectedOrientation, Orientation;
+	FVector ExpectedPosition, Position;
+	const bool bExpectedPointer = HandTracker.GetPointerPose(Hand, ExpectedOrientation, ExpectedPosition);
+	TestTrue("Pointer is tracked", Snapshot.GetPointerPose(Orientation, Position) == bExpectedPointer);
+	if (bExpectedPointer)
+	{
+		TestTrue("Pointer orientation", Orientation.Equals(ExpectedOrientation));
+		TestEqual("Pointer position", Position, ExpectedPosition);
+	}
+
+	const bool bExpectedGrip = HandTracker.GetGripPose(Hand, ExpectedOrientation, ExpectedPosition);
+	TestTrue("Grip is tracked", Snapshot.GetGripPose(Orientation, Position) == bExpectedGrip);
+	if (bExpectedGrip)
+	{
+		TestTrue("Grip orientation", Orientation.Equals(ExpectedOrientation));
+		TestEqual("Grip position", Position, ExpectedPosition);
+	}
+}
+
+void HandSnapshotSpec::Define()
+{
+	BeforeEach([this] {
+		HandTracker = FUxtTestHandTracker();
+		HandTracker.SetAllJointPositions(LeftPosition, EControllerHand::Left);
+		HandTracker.SetAllJointOrientations(LeftOrientation, EControllerHand::Left);
+		HandTracker.SetAllJointPositions(RightPosition, EControllerHand::Right);
+		HandTracker.SetAllJointOrientations(RightOrientation, EControllerHand::Right);
+		HandTracker.SetJointPosition(FVector(1, 2, 3), EControllerHand::Right, EHandKeypoint::IndexTip);
+		HandTracker.SetJointRadius(0.5f, EControllerHand::Right, EHandKeypoint::ThumbTip);
+	});
+
+	Describe("Hand snapshot", [this] {
+		It("should match the individual getters of a tracked hand", [this] {
+			TestMatchesGetters(HandTracker.GetHandSnapshot(EControllerHand::Left), EControllerHand::Left);
+			TestMatchesGetters(HandTracker.GetHandSnapshot(EControllerHand::Right), EControllerHand::Right);
+		});
+
+		It("should have no joints or poses for an untracked hand", [this] {
+			HandTracker.SetTracked(false, EControllerHand::Right);
+
+			const FUxtHandSnapshot& Snapshot = HandTracker.GetHandSnapshot(EControllerHand::Right);
+			TestTrue("Hand is not tracked", Snapshot.TrackingStatus == ETrackingStatus::NotTracked);
+			TestFalse("Snapshot has joints", Snapshot.bHasJoints);
+			TestFalse("Snapshot has pointer pose", Snapshot.bHasPointerPose);
+			TestFalse("Snapshot has grip pose", Snapshot.bHasGripPose);
+			TestMatchesGetters(Snapshot, EControllerHand::Right);
+		});
+
+		It("should report the pointer pose of a hand without a grip pose", [this] {
+			FPointerOnlyHandTracker PointerOnlyHandTracker;
+
+			const FUxtHandSnapshot& Snapshot = PointerOnlyHandTracker.GetHandSnapshot(EControllerHand::Left);
+			TestTrue("Snapshot has pointer pose", Snapshot.bHasPointerPose);
+			TestFalse("Snapshot has grip pose", Snapshot.bHasGripPose);
+
+			FQuat Orientation;
+			FVector Position;
+			TestTrue("Pointer pose is available", Snapshot.GetPointerPose(Orientation, Position));
+			TestFalse("Grip pose is available", Snapshot.GetGripPose(Orientation, Position));
+		});
+
+		It("should keep a separate snapshot for each hand", [this] {
+			const FUxtHandSnapshot& LeftSnapshot = HandTracker.GetHandSnapshot(EControllerHand::Left);
+			const FUxtHandSnapshot& RightSnapshot = HandTracker.GetHandSnapshot(EControllerHand::Right);
+			TestTrue("Snapshots are distinct", &LeftSnapshot != &RightSnapshot);
+
+			TestEqual("Left palm position", LeftSnapshot.JointPositions[(int32)EHandKeypoint::Palm], LeftPosition);
+			TestEqual("Right palm position", RightSnapshot.JointPositions[(int32)EHandKeypoint::Palm], RightPosition);
+		});
+
+		It("should keep separate snapshots for each tracker", [this] {
+			FUxtTestHandTracker OtherHandTracker;
+			OtherHandTracker.SetAllJointPositions(RightPosition, EControllerHand::Left);
+
+			const FUxtHandSnapshot& Snapshot = HandTracker.GetHandSnapshot(EControllerHand::Left);
+			const FUxtHandSnapshot& OtherSnapshot = OtherHandTracker.GetHandSnapshot(EControllerHand::Left);
+			TestTrue("Snapshots are distinct", &Snapshot != &OtherSnapshot);
+
+			TestEqual("Palm position", Snapshot.JointPositions[(int32)EHandKeypoint::Palm], LeftPosition);
+			TestEqual("Other palm position", OtherSnapshot.JointPositions[(int32)EHandKeypoint::Palm], RightPosition);
+		});
+
+		It("should reflect hand data changed within the same frame", [this] {
+			TestEqual(
+				"Initial position", HandTracker.GetHandSnapshot(EControllerHand::Left).JointPositions[(int32)EHandKeypoint::Palm],
+				LeftPosition);
+
+			HandTracker.SetAllJointPositions(FVector(5, 5, 5), EControllerHand::Left);
+			HandTracker.SetTracked(false, EControllerHand::Right);
+
+			const FUxtHandSnapshot& LeftSnapshot = HandTracker.GetHandSnapshot(EControllerHand::Left);
+			TestEqual("Updated position", LeftSnapshot.JointPositions[(int32)EHandKeypoint::Palm], FVector(5, 5, 5));
+			TestMatchesGetters(LeftSnapshot, EControllerHand::Left);
+			TestFalse("Tracking loss is reported", HandTracker.GetHandSnapshot(EControllerHand::Right).bHasJoints);
+		});
+
+		It("should be assembled once per frame", [this] {
+			const FUxtHandSnapshot& Snapshot = HandTracker.GetHandSnapshot(EControllerHand::Left);
+			TestTrue("Same snapshot", &HandTracker.GetHandSnapshot(EControllerHand::Left) == &Snapshot);
+			TestTrue("Frame", Snapshot.FrameId == GFrameCounter);
+		});
+
+		It("should be readable as a published snapshot on the game thread", [this] {
+			FUxtHandSnapshot Snapshot;
+			TestTrue("Snapshot is available", HandTracker.ReadPublishedHandSnapshot(EControllerHand::Right, Snapshot));
+			TestMatchesGetters(Snapshot, EControllerHand::Right);
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
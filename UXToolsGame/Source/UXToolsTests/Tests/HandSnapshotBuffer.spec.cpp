@@ -0,0 +1,205 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "HandTracking/UxtHandSnapshotBuffer.h"
+#include "Templates/Atomic.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Maximum time spent publishing and reading concurrently. */
+	const double ConcurrentTestDuration = 5.0;
+
+	/** Number of reads each reader does at least before the concurrent test may stop. */
+	const uint32 MinReadsPerReader = 10000;
+
+	/** Added to the frame id of right hand snapshots, so that mixing up hands is detected as well. */
+	const uint64 RightHandOffset = 1ull << 32;
+
+	/** Fill every field of the snapshot with a value derived from the frame id. */
+	void MakeSnapshot(uint64 FrameId, FUxtHandSnapshot& OutSnapshot)
+	{
+		// Keep values small enough to be represented exactly, neighbouring frames always differ
+		const float Value = (float)((FrameId & 0xFFFF) + (FrameId >= RightHandOffset ? 0x10000 : 0));
+		const bool bOdd = (FrameId & 1) != 0;
+
+		OutSnapshot.FrameId = FrameId;
+		OutSnapshot.TrackingStatus = bOdd ? ETrackingStatus::Tracked : ETrackingStatus::InertialOnly;
+		OutSnapshot.bHasJoints = bOdd;
+		OutSnapshot.bHasPointerPose = !bOdd;
+		OutSnapshot.bHasGripPose = bOdd;
+
+		for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+		{
+			OutSnapshot.JointOrientations[Joint] = FQuat(Value, Value, Value, Value);
+			OutSnapshot.JointPositions[Joint] = FVector(Value);
+			OutSnapshot.JointRadii[Joint] = Value;
+		}
+
+		OutSnapshot.PointerOrientation = FQuat(Value, Value, Value, Value);
+		OutSnapshot.PointerPosition = FVector(Value);
+		OutSnapshot.GripOrientation = FQuat(Value, Value, Value, Value);
+		OutSnapshot.GripPosition = FVector(Value);
+	}
+
+	/** True if every field of the snapshot matches its frame id, i.e. it was not partially overwritten. */
+	bool IsConsistent(const FUxtHandSnapshot& Snapshot)
+	{
+		FUxtHandSnapshot Expected;
+		MakeSnapshot(Snapshot.FrameId, Expected);
+
+		if (Snapshot.TrackingStatus != Expected.TrackingStatus || Snapshot.bHasJoints != Expected.bHasJoints ||
+			Snapshot.bHasPointerPose != Expected.bHasPointerPose || Snapshot.bHasGripPose != Expected.bHasGripPose)
+		{
+			return false;
+		}
+
+		for (int32 Joint = 0; Joint < EHandKeypointCount; ++Joint)
+		{
+			if (Snapshot.JointOrientations[Joint] != Expected.JointOrientations[Joint] ||
+				Snapshot.JointPositions[Joint] != Expected.JointPositions[Joint] ||
+				Snapshot.JointRadii[Joint] != Expected.JointRadii[Joint])
+			{
+				return false;
+			}
+		}
+
+		return Snapshot.PointerOrientation == Expected.PointerOrientation && Snapshot.PointerPosition == Expected.PointerPosition &&
+			   Snapshot.GripOrientation == Expected.GripOrientation && Snapshot.GripPosition == Expected.GripPosition;
+	}
+
+	/** Results of one reader, only written by that reader. */
+	struct FReaderStats
+	{
+		TAtomic<uint32> NumReads{0};
+		TAtomic<uint32> NumTornReads{0};
+		TAtomic<uint32> NumOutOfOrderReads{0};
+	};
+
+	/** Read both hands once, checking that the snapshots are consistent and never older than the previous read. */
+	void ReadAndCheck(const FUxtHandSnapshotBuffer& Buffer, uint64 LastFrameIds[2], FReaderStats& Stats)
+	{
+		for (int32 HandIndex = 0; HandIndex < 2; ++HandIndex)
+		{
+			const EControllerHand Hand = HandIndex == 0 ? EControllerHand::Left : EControllerHand::Right;
+
+			FUxtHandSnapshot Snapshot;
+			Buffer.Read(Hand, Snapshot);
+			++Stats.NumReads;
+
+			// Frame id is 0 until the first publish, the snapshot is not initialized then
+			if (Snapshot.FrameId != 0)
+			{
+				const bool bIsRightSnapshot = Snapshot.FrameId >= RightHandOffset;
+				if (!IsConsistent(Snapshot) || bIsRightSnapshot != (HandIndex == 1))
+				{
+					++Stats.NumTornReads;
+				}
+			}
+			if (Snapshot.FrameId < LastFrameIds[HandIndex])
+			{
+				++Stats.NumOutOfOrderReads;
+			}
+			LastFrameIds[HandIndex] = Snapshot.FrameId;
+		}
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	HandSnapshotBufferSpec, "UXTools.HandTracking.SnapshotBuffer",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext)
+
+void TestReaderStats(const FString& Reader, const FReaderStats& Stats);
+
+END_DEFINE_SPEC(HandSnapshotBufferSpec)
+
+void HandSnapshotBufferSpec::TestReaderStats(const FString& Reader, const FReaderStats& Stats)
+{
+	TestTrue(FString::Printf(TEXT("%s has read snapshots"), *Reader), Stats.NumReads.Load() > 0);
+	TestEqual(FString::Printf(TEXT("%s torn reads"), *Reader), (int32)Stats.NumTornReads.Load(), 0);
+	TestEqual(FString::Printf(TEXT("%s out of order reads"), *Reader), (int32)Stats.NumOutOfOrderReads.Load(), 0);
+}
+
+void HandSnapshotBufferSpec::Define()
+{
+	Describe("Hand snapshot buffer", [this] {
+		It("should read the last published snapshot of each hand", [this] {
+			FUxtHandSnapshotBuffer Buffer;
+			TestEqual("Nothing published", (int32)Buffer.GetNumPublished(), 0);
+
+			FUxtHandSnapshot Left, Right;
+			for (uint64 FrameId = 1; FrameId <= 3; ++FrameId)
+			{
+				MakeSnapshot(FrameId, Left);
+				MakeSnapshot(FrameId + RightHandOffset, Right);
+				Buffer.Publish(Left, Right);
+			}
+			TestEqual("Number of publishes", (int32)Buffer.GetNumPublished(), 3);
+
+			FUxtHandSnapshot Snapshot;
+			Buffer.Read(EControllerHand::Left, Snapshot);
+			TestTrue("Left snapshot is the last published", Snapshot.FrameId == 3);
+			TestTrue("Left snapshot is consistent", IsConsistent(Snapshot));
+
+			Buffer.Read(EControllerHand::Right, Snapshot);
+			TestTrue("Right snapshot is the last published", Snapshot.FrameId == 3 + RightHandOffset);
+			TestTrue("Right snapshot is consistent", IsConsistent(Snapshot));
+			TestEqual("Reads without retries", (int32)Buffer.GetNumReadRetries(), 0);
+		});
+
+		It("should never return torn snapshots while publishing from another thread", [this] {
+			FUxtHandSnapshotBuffer Buffer;
+			TAtomic<bool> bStop{false};
+			FReaderStats WorkerStats;
+			FReaderStats GameThreadStats;
+
+			TFuture<void> Writer = Async(EAsyncExecution::Thread, [&Buffer, &bStop] {
+				FUxtHandSnapshot Left, Right;
+				for (uint64 FrameId = 1; !bStop.Load(); ++FrameId)
+				{
+					MakeSnapshot(FrameId, Left);
+					MakeSnapshot(FrameId + RightHandOffset, Right);
+					Buffer.Publish(Left, Right);
+				}
+			});
+
+			TFuture<void> Reader = Async(EAsyncExecution::Thread, [&Buffer, &bStop, &WorkerStats] {
+				uint64 LastFrameIds[2] = {0, 0};
+				while (!bStop.Load())
+				{
+					ReadAndCheck(Buffer, LastFrameIds, WorkerStats);
+				}
+			});
+
+			// Read on the game thread as well until reads have been retried, or the time budget runs out
+			const double EndTime = FPlatformTime::Seconds() + ConcurrentTestDuration;
+			uint64 LastFrameIds[2] = {0, 0};
+			while (FPlatformTime::Seconds() < EndTime)
+			{
+				ReadAndCheck(Buffer, LastFrameIds, GameThreadStats);
+
+				if (GameThreadStats.NumReads.Load() >= MinReadsPerReader && WorkerStats.NumReads.Load() >= MinReadsPerReader &&
+					Buffer.GetNumReadRetries() > 0)
+				{
+					break;
+				}
+			}
+
+			bStop = true;
+			Writer.Wait();
+			Reader.Wait();
+
+			TestTrue("Snapshots have been published", Buffer.GetNumPublished() > 0);
+			TestReaderStats(TEXT("Worker thread"), WorkerStats);
+			TestReaderStats(TEXT("Game thread"), GameThreadStats);
+			TestTrue("Reads have been retried", Buffer.GetNumReadRetries() > 0);
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
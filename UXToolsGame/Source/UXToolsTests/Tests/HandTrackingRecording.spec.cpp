@@ -0,0 +1,261 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "FrameQueue.h"
+#include "UxtTestHandTracker.h"
+#include "UxtTestUtils.h"
+
+#include "Engine/World.h"
+#include "Features/IModularFeatures.h"
+#include "HAL/FileManager.h"
+#include "HandTracking/UxtHandTrackingRecording.h"
+#include "HandTracking/UxtHandTrackingRecordingSubsystem.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tests/AutomationCommon.h"
+#include "Utils/UxtFunctionLibrary.h"
+#include "Utils/UxtHeadPoseSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const int32 NumRecordedFrames = 10;
+
+	FString GetRecordingFilename()
+	{
+		return FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("HandTrackingRecording.uxht"));
+	}
+
+	FVector GetRecordedPosition(int32 Frame)
+	{
+		return FVector(100, Frame * 10.0f, 0);
+	}
+
+	FTransform GetRecordedHeadPose(int32 Frame)
+	{
+		return FTransform(FRotator(0, Frame, 0), FVector(0, 0, Frame));
+	}
+
+	/** Record a session where the right hand moves every frame, pinches on odd frames and the left hand is lost on even frames. */
+	void RecordTestSession(FUxtTestHandTracker& HandTracker, const FString& Filename)
+	{
+		FUxtHandTrackingRecorder Recorder;
+		Recorder.Open(Filename);
+
+		for (int32 Frame = 0; Frame < NumRecordedFrames; ++Frame)
+		{
+			HandTracker.SetAllJointPositions(GetRecordedPosition(Frame), EControllerHand::Right);
+			HandTracker.SetSelectPressed(Frame % 2 == 1, EControllerHand::Right);
+			HandTracker.SetGrabbing(Frame % 2 == 1, EControllerHand::Right);
+			HandTracker.SetTracked(Frame % 2 == 1, EControllerHand::Left);
+
+			Recorder.RecordFrame(HandTracker, GetRecordedHeadPose(Frame), Frame / 60.0);
+		}
+
+		Recorder.Close();
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	HandTrackingRecordingSpec, "UXTools.HandTrackingRecording",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext)
+
+FUxtTestHandTracker SourceHandTracker;
+FUxtHandTrackingPlayer Player;
+UUxtHandTrackingRecordingSubsystem* Subsystem = nullptr;
+FFrameQueue FrameQueue;
+
+UUxtHeadPoseSubsystem* GetHeadPoseSubsystem() const;
+
+END_DEFINE_SPEC(HandTrackingRecordingSpec)
+
+UUxtHeadPoseSubsystem* HandTrackingRecordingSpec::GetHeadPoseSubsystem() const
+{
+	return Subsystem->GetWorld()->GetSubsystem<UUxtHeadPoseSubsystem>();
+}
+
+void HandTrackingRecordingSpec::Define()
+{
+	BeforeEach([this] {
+		SourceHandTracker = FUxtTestHandTracker();
+		RecordTestSession(SourceHandTracker, GetRecordingFilename());
+	});
+
+	AfterEach([this] {
+		Player.Close();
+		IFileManager::Get().Delete(*GetRecordingFilename());
+	});
+
+	Describe("Player", [this] {
+		It("should replay every recorded frame", [this] {
+			TestTrue("Recording opened", Player.Open(GetRecordingFilename()));
+			TestEqual("Number of frames", Player.GetNumFrames(), NumRecordedFrames);
+			TestEqual("Starts at the first frame", Player.GetFrameIndex(), 0);
+
+			for (int32 Frame = 0; Frame < NumRecordedFrames; ++Frame)
+			{
+				TestTrue("Frame is available", Player.SetFrameIndex(Frame));
+				TestEqual("Frame time", Player.GetFrameTime(), Frame / 60.0);
+				TestTrue("Head pose", Player.GetHeadPose().Equals(GetRecordedHeadPose(Frame)));
+
+				FQuat Orientation;
+				FVector Position;
+				float Radius;
+				TestTrue(
+					"Right joints are tracked",
+					Player.GetJointState(EControllerHand::Right, EHandKeypoint::Palm, Orientation, Position, Radius));
+				TestEqual("Right joint position", Position, GetRecordedPosition(Frame));
+				TestEqual("Right joint radius", Radius, 1.0f);
+
+				TestTrue("Right pointer is tracked", Player.GetPointerPose(EControllerHand::Right, Orientation, Position));
+				TestEqual("Right pointer position", Position, GetRecordedPosition(Frame));
+
+				TestTrue(
+					"Right predicted pointer is tracked", Player.GetPredictedPointerPose(EControllerHand::Right, Orientation, Position));
+				TestEqual("Right predicted pointer position", Position, GetRecordedPosition(Frame));
+
+				bool bIsSelectPressed = false;
+				bool bIsGrabbing = false;
+				TestTrue("Right select state is known", Player.GetIsSelectPressed(EControllerHand::Right, bIsSelectPressed));
+				TestTrue("Right grab state is known", Player.GetIsGrabbing(EControllerHand::Right, bIsGrabbing));
+				TestTrue("Right select state", bIsSelectPressed == (Frame % 2 == 1));
+				TestTrue("Right grab state", bIsGrabbing == (Frame % 2 == 1));
+
+				const bool bLeftTracked = Frame % 2 == 1;
+				const bool bLeftStatusTracked = Player.GetTrackingStatus(EControllerHand::Left) == ETrackingStatus::Tracked;
+				TestTrue("Left tracking status", bLeftStatusTracked == bLeftTracked);
+				TestTrue("Left pointer is tracked", Player.GetPointerPose(EControllerHand::Left, Orientation, Position) == bLeftTracked);
+				TestTrue("Left grab state is known", Player.GetIsGrabbing(EControllerHand::Left, bIsGrabbing) == bLeftTracked);
+			}
+
+			TestFalse("Frame after the end", Player.SetFrameIndex(NumRecordedFrames));
+			TestEqual("Frame is unchanged", Player.GetFrameIndex(), NumRecordedFrames - 1);
+		});
+
+		It("should report the recorded delta times", [this] {
+			TestTrue("Recording opened", Player.Open(GetRecordingFilename()));
+			for (int32 Frame = 0; Frame < NumRecordedFrames; ++Frame)
+			{
+				TestEqual("Frame delta time", (float)Player.GetFrameDeltaTime(Frame), 1.0f / 60.0f);
+			}
+		});
+
+		It("should replay an unfinished recording up to its last complete frame", [this] {
+			// Cut the last frame short, as if the recording application crashed while writing it
+			TArray<uint8> Data;
+			FFileHelper::LoadFileToArray(Data, *GetRecordingFilename());
+			Data.SetNum(Data.Num() - 10);
+			FFileHelper::SaveArrayToFile(Data, *GetRecordingFilename());
+
+			TestTrue("Recording opened", Player.Open(GetRecordingFilename()));
+			TestEqual("Number of frames", Player.GetNumFrames(), NumRecordedFrames - 1);
+			TestTrue("Last complete frame is available", Player.SetFrameIndex(NumRecordedFrames - 2));
+
+			FQuat Orientation;
+			FVector Position;
+			TestTrue("Right pointer is tracked", Player.GetPointerPose(EControllerHand::Right, Orientation, Position));
+			TestEqual("Right pointer position", Position, GetRecordedPosition(NumRecordedFrames - 2));
+		});
+
+		It("should reject files that are not recordings", [this] {
+			FFileHelper::SaveStringToFile(TEXT("Not a recording"), *GetRecordingFilename());
+
+			AddExpectedError(TEXT("is not a valid hand tracking recording"), EAutomationExpectedErrorFlags::Contains, 1);
+			TestFalse("Recording opened", Player.Open(GetRecordingFilename()));
+			TestFalse("Player is open", Player.IsOpen());
+			TestTrue("Hand is not tracked", Player.GetTrackingStatus(EControllerHand::Right) == ETrackingStatus::NotTracked);
+		});
+	});
+
+	Describe("Subsystem", [this] {
+		BeforeEach([this] {
+			TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+
+			UWorld* World = UxtTestUtils::GetTestWorld();
+			FrameQueue.Init(&World->GetGameInstance()->GetTimerManager());
+
+			Subsystem = World->GetSubsystem<UUxtHandTrackingRecordingSubsystem>();
+			TestNotNull("Recording subsystem exists", Subsystem);
+		});
+
+		AfterEach([this] {
+			FrameQueue.Reset();
+			Subsystem->StopPlayback();
+			Subsystem = nullptr;
+		});
+
+		LatentIt("should replay one recorded frame per engine frame", [this](const FDoneDelegate& Done) {
+			const IUxtHandTracker* ReplacedHandTracker = &IUxtHandTracker::Get();
+			const bool bUseFixedTimeStep = FApp::UseFixedTimeStep();
+
+			FrameQueue.Enqueue([this, ReplacedHandTracker] {
+				TestTrue("Playback started", Subsystem->StartPlayback(GetRecordingFilename()));
+				TestTrue("Fixed time step is used", FApp::UseFixedTimeStep());
+				TestEqual("Playback frame", Subsystem->GetPlaybackFrameIndex(), 0);
+
+				// Playback shadows the registered hand tracker without unregistering it
+				IModularFeatures& Features = IModularFeatures::Get();
+				const FName FeatureName = IUxtHandTracker::GetModularFeatureName();
+				TestTrue("Hand tracker is overridden", IUxtHandTracker::GetOverride() != nullptr);
+				TestTrue(
+					"Hand tracker stays registered",
+					!Features.IsModularFeatureAvailable(FeatureName) ||
+						&Features.GetModularFeature<IUxtHandTracker>(FeatureName) == ReplacedHandTracker);
+				TestTrue("Head pose is overridden", GetHeadPoseSubsystem()->HasHeadPoseOverride());
+				TestTrue(
+					"Head pose override applies immediately",
+					UUxtFunctionLibrary::GetHeadPose(Subsystem->GetWorld()).Equals(GetRecordedHeadPose(0)));
+			});
+
+			for (int32 Frame = 1; Frame < NumRecordedFrames; ++Frame)
+			{
+				FrameQueue.Enqueue([this, Frame] {
+					TestEqual("Playback frame", Subsystem->GetPlaybackFrameIndex(), Frame);
+					TestEqual("Recorded delta time", (float)FApp::GetDeltaTime(), 1.0f / 60.0f);
+
+					FQuat Orientation;
+					FVector Position;
+					TestTrue("Pointer is tracked", IUxtHandTracker::Get().GetPointerPose(EControllerHand::Right, Orientation, Position));
+					TestEqual("Pointer position", Position, GetRecordedPosition(Frame));
+					TestTrue(
+						"Head pose", UUxtFunctionLibrary::GetHeadPose(Subsystem->GetWorld()).Equals(GetRecordedHeadPose(Frame)));
+				});
+			}
+
+			FrameQueue.Enqueue([this, ReplacedHandTracker, bUseFixedTimeStep, Done] {
+				TestFalse("Playback stops after the last frame", Subsystem->IsPlaying());
+				TestTrue("Time step is restored", FApp::UseFixedTimeStep() == bUseFixedTimeStep);
+				TestTrue("Hand tracker override is cleared", IUxtHandTracker::GetOverride() == nullptr);
+				TestTrue("Hand tracker is restored", &IUxtHandTracker::Get() == ReplacedHandTracker);
+				TestFalse("Head pose override is cleared", GetHeadPoseSubsystem()->HasHeadPoseOverride());
+				Done.Execute();
+			});
+		});
+
+		It("should restore the hand tracker override it replaced", [this] {
+			IUxtHandTracker::SetOverride(&SourceHandTracker);
+
+			TestTrue("Playback started", Subsystem->StartPlayback(GetRecordingFilename()));
+			TestTrue("Hand tracker is overridden", IUxtHandTracker::GetOverride() != &SourceHandTracker);
+			Subsystem->StopPlayback();
+			TestTrue("Previous override is restored", IUxtHandTracker::GetOverride() == &SourceHandTracker);
+
+			IUxtHandTracker::SetOverride(nullptr);
+		});
+
+		It("should start and stop recording", [this] {
+			TestTrue("Recording started", Subsystem->StartRecording(GetRecordingFilename()));
+			TestTrue("Is recording", Subsystem->IsRecording());
+			Subsystem->StopRecording();
+			TestFalse("Is recording", Subsystem->IsRecording());
+
+			TestTrue("Recording opened", Player.Open(GetRecordingFilename()));
+			TestEqual("Number of frames", Player.GetNumFrames(), 0);
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
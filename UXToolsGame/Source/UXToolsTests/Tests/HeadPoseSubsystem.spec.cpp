@@ -0,0 +1,133 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "FrameQueue.h"
+#include "UxtTestUtils.h"
+
+#include "Engine/World.h"
+#include "Tests/AutomationCommon.h"
+#include "Utils/UxtFunctionLibrary.h"
+#include "Utils/UxtHeadPoseSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+	HeadPoseSubsystemSpec, "UXTools.HeadPoseSubsystem",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext)
+
+UUxtHeadPoseSubsystem* Subsystem = nullptr;
+FFrameQueue FrameQueue;
+
+END_DEFINE_SPEC(HeadPoseSubsystemSpec)
+
+void HeadPoseSubsystemSpec::Define()
+{
+	Describe("Head pose subsystem", [this] {
+		BeforeEach([this] {
+			TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+
+			UWorld* World = UxtTestUtils::GetTestWorld();
+			FrameQueue.Init(&World->GetGameInstance()->GetTimerManager());
+
+			Subsystem = World->GetSubsystem<UUxtHeadPoseSubsystem>();
+			TestNotNull("Head pose subsystem exists", Subsystem);
+
+			UxtTestUtils::SetTestHeadEnabled(true);
+			UxtTestUtils::SetTestHeadLocation(FVector::ZeroVector);
+			UxtTestUtils::SetTestHeadRotation(FRotator::ZeroRotator);
+		});
+
+		AfterEach([this] {
+			FrameQueue.Reset();
+			UxtTestUtils::SetTestHeadEnabled(false);
+			Subsystem->ClearHeadPoseOverride();
+			Subsystem = nullptr;
+		});
+
+		LatentIt("should sample the head pose once per frame", [this](const FDoneDelegate& Done) {
+			FrameQueue.Enqueue([this] {
+				TestTrue("Head pose is sampled in this frame", Subsystem->GetFrameId() == GFrameCounter);
+				TestEqual("Sampled head location", Subsystem->GetHeadPose().GetLocation(), FVector::ZeroVector);
+
+				UxtTestUtils::SetTestHeadLocation(FVector(100, 0, 0));
+				TestEqual("Head pose is not sampled again in the same frame", Subsystem->GetHeadPose().GetLocation(), FVector::ZeroVector);
+			});
+
+			FrameQueue.Enqueue([this, Done] {
+				TestEqual("Head pose is sampled in the next frame", Subsystem->GetHeadPose().GetLocation(), FVector(100, 0, 0));
+				TestEqual(
+					"Function library returns the sampled head pose", UUxtFunctionLibrary::GetHeadPose(Subsystem->GetWorld()).GetLocation(),
+					FVector(100, 0, 0));
+				Done.Execute();
+			});
+		});
+
+		LatentIt("should estimate head velocities", [this](const FDoneDelegate& Done) {
+			FrameQueue.Enqueue([this] {
+				UxtTestUtils::SetTestHeadLocation(FVector(10, 0, 0));
+				UxtTestUtils::SetTestHeadRotation(FRotator(0, 10, 0));
+			});
+
+			FrameQueue.Enqueue([this, Done] {
+				const FVector LinearVelocity = Subsystem->GetLinearVelocity();
+				TestTrue("Head moves forward", LinearVelocity.X > 0.0f);
+				TestEqual("Head does not move sideways", LinearVelocity.Y, 0.0f);
+				TestEqual("Head does not move vertically", LinearVelocity.Z, 0.0f);
+
+				const FVector AngularVelocity = Subsystem->GetAngularVelocity();
+				TestTrue("Head turns about the vertical axis", FMath::Abs(AngularVelocity.Z) > 0.0f);
+				TestEqual("Head does not roll", AngularVelocity.X, 0.0f);
+				TestEqual("Head does not pitch", AngularVelocity.Y, 0.0f);
+				Done.Execute();
+			});
+		});
+
+		LatentIt("should return the cached head pose without test data", [this](const FDoneDelegate& Done) {
+			UxtTestUtils::SetTestHeadEnabled(false);
+
+			FrameQueue.Enqueue([this] {
+				// Sampled before actors tick, nothing has read the head pose in this frame yet
+				TestTrue("Head pose is sampled in this frame", Subsystem->GetFrameId() == GFrameCounter);
+
+				UWorld* World = Subsystem->GetWorld();
+				const FTransform HeadPose = Subsystem->GetHeadPose();
+				TestTrue("Sampled head pose matches the XR system", HeadPose.Equals(UUxtHeadPoseSubsystem::QueryHeadPose(World)));
+				TestTrue("Function library returns the sampled head pose", UUxtFunctionLibrary::GetHeadPose(World).Equals(HeadPose));
+			});
+
+			FrameQueue.Enqueue([this, Done] {
+				TestTrue("Head pose is sampled in the next frame", Subsystem->GetFrameId() == GFrameCounter);
+				TestTrue(
+					"Function library returns the sampled head pose",
+					UUxtFunctionLibrary::GetHeadPose(Subsystem->GetWorld()).Equals(Subsystem->GetHeadPose()));
+				Done.Execute();
+			});
+		});
+
+		LatentIt("should prefer the head pose override over test data", [this](const FDoneDelegate& Done) {
+			const FVector OverrideLocation(0, 0, 50);
+
+			FrameQueue.Enqueue([this, OverrideLocation] {
+				Subsystem->SetHeadPoseOverride(FTransform(OverrideLocation));
+				TestTrue("Head pose is overridden", Subsystem->HasHeadPoseOverride());
+				TestEqual("Override applies in the current frame", Subsystem->GetHeadPose().GetLocation(), OverrideLocation);
+				TestEqual(
+					"Function library returns the override", UUxtFunctionLibrary::GetHeadPose(Subsystem->GetWorld()).GetLocation(),
+					OverrideLocation);
+			});
+
+			FrameQueue.Enqueue([this, OverrideLocation] {
+				TestEqual("Override is kept in the next frame", Subsystem->GetHeadPose().GetLocation(), OverrideLocation);
+
+				Subsystem->ClearHeadPoseOverride();
+				TestFalse("Head pose is not overridden", Subsystem->HasHeadPoseOverride());
+				TestEqual("Test data applies again", Subsystem->GetHeadPose().GetLocation(), FVector::ZeroVector);
+			});
+
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
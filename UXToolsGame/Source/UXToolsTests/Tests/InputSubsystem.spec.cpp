@@ -0,0 +1,373 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "FarTargetTestComponent.h"
+#include "FrameQueue.h"
+#include "UxtTestTargetComponent.h"
+#include "UxtTestUtils.h"
+
+#include "Components/SceneComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Input/UxtFarPointerComponent.h"
+#include "Input/UxtInputSubsystem.h"
+#include "Input/UxtNearPointerComponent.h"
+#include "Interactions/UxtGrabTarget.h"
+#include "Interactions/UxtPokeTarget.h"
+#include "Tests/AutomationCommon.h"
+#include "UObject/UObjectGlobals.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	UTestGrabTarget* AddGrabTarget(AActor* Actor)
+	{
+		UTestGrabTarget* Target = NewObject<UTestGrabTarget>(Actor);
+		Target->RegisterComponent();
+		return Target;
+	}
+
+	UFarTargetTestComponent* AddFarTarget(AActor* Actor)
+	{
+		UFarTargetTestComponent* Target = NewObject<UFarTargetTestComponent>(Actor);
+		Target->RegisterComponent();
+		return Target;
+	}
+
+	/** Replace a component of the actor with a new far target, leaving the number of owned components unchanged. */
+	UFarTargetTestComponent* ReplaceComponentWithFarTarget(AActor* Actor, UActorComponent* Component)
+	{
+		Component->DestroyComponent();
+		return AddFarTarget(Actor);
+	}
+
+	bool ContainsComponent(const FUxtInterfaceComponentArray& Components, const UActorComponent* Component)
+	{
+		return Components.ContainsByPredicate(
+			[Component](const TWeakObjectPtr<UActorComponent>& ComponentWeak) { return ComponentWeak.Get() == Component; });
+	}
+
+	UUxtInputSubsystem* GetInputSubsystem()
+	{
+		return UxtTestUtils::GetTestWorld()->GetGameInstance()->GetSubsystem<UUxtInputSubsystem>();
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	InputSubsystemSpec, "UXTools.InputSubsystem",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext)
+
+AActor* Actor = nullptr;
+UStaticMeshComponent* Primitive = nullptr;
+USceneComponent* OtherComponent = nullptr;
+UUxtFarPointerComponent* FarPointer = nullptr;
+FFrameQueue FrameQueue;
+
+END_DEFINE_SPEC(InputSubsystemSpec)
+
+void InputSubsystemSpec::Define()
+{
+	BeforeEach([this] {
+		TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+
+		Actor = UxtTestUtils::GetTestWorld()->SpawnActor<AActor>();
+		Primitive = UxtTestUtils::CreateStaticMesh(Actor);
+		Actor->SetRootComponent(Primitive);
+		Primitive->RegisterComponent();
+
+		OtherComponent = NewObject<USceneComponent>(Actor);
+		OtherComponent->RegisterComponent();
+	});
+
+	AfterEach([this] {
+		Actor->Destroy();
+		Actor = nullptr;
+		Primitive = nullptr;
+		OtherComponent = nullptr;
+	});
+
+	Describe("Interface component cache", [this] {
+		It("should return the components implementing the interface", [this] {
+			UTestGrabTarget* Target = AddGrabTarget(Actor);
+
+			const FUxtInterfaceComponentArray Components = UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtGrabTarget::StaticClass());
+			TestEqual("Number of components", Components.Num(), 1);
+			TestTrue("Target is cached", ContainsComponent(Components, Target));
+
+			const FUxtInterfaceComponentArray CachedComponents =
+				UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtGrabTarget::StaticClass());
+			TestTrue("Cached entry is reused", CachedComponents == Components);
+		});
+
+		It("should rebuild when a target is created with another component as outer", [this] {
+			UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtGrabTarget::StaticClass());
+
+			// Owner is found through the outer chain, as for components created by other components
+			UTestGrabTarget* Target = NewObject<UTestGrabTarget>(OtherComponent);
+			Target->RegisterComponent();
+
+			const FUxtInterfaceComponentArray Components = UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtGrabTarget::StaticClass());
+			TestTrue("Target is cached", ContainsComponent(Components, Target));
+		});
+
+		It("should remove a target when it is unregistered", [this] {
+			UTestGrabTarget* Target = AddGrabTarget(Actor);
+			UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtGrabTarget::StaticClass());
+
+			Target->UnregisterComponent();
+			TestFalse(
+				"Unregistered target is not cached",
+				ContainsComponent(UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtGrabTarget::StaticClass()), Target));
+
+			Target->RegisterComponent();
+			TestTrue(
+				"Registered target is cached",
+				ContainsComponent(UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtGrabTarget::StaticClass()), Target));
+		});
+
+		It("should rebuild when a component that does not notify the subsystem is created", [this] {
+			UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtPokeTarget::StaticClass());
+
+			// The poke target does not call RegisterInterfaceComponent, it is found because the actor's component set has grown
+			UTestPokeTarget* Target = NewObject<UTestPokeTarget>(Actor);
+			Target->RegisterComponent();
+
+			const FUxtInterfaceComponentArray Components = UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtPokeTarget::StaticClass());
+			TestTrue("Target is cached", ContainsComponent(Components, Target));
+		});
+
+		It("should return no components without an actor", [this] {
+			TestEqual("Number of components", UUxtInputSubsystem::GetInterfaceComponents(nullptr, UUxtGrabTarget::StaticClass()).Num(), 0);
+		});
+
+		It("should rebuild when a target is swapped within one frame", [this] {
+			UTestGrabTarget* OldTarget = AddGrabTarget(Actor);
+			UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtGrabTarget::StaticClass());
+
+			// Same number of components before and after
+			OldTarget->DestroyComponent();
+			UTestGrabTarget* NewTarget = AddGrabTarget(Actor);
+
+			const FUxtInterfaceComponentArray& Components =
+				UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtGrabTarget::StaticClass());
+			TestEqual("Number of components", Components.Num(), 1);
+			TestTrue("New target is cached", ContainsComponent(Components, NewTarget));
+			TestFalse("Old target is not cached", ContainsComponent(Components, OldTarget));
+		});
+
+		It("should rebuild when another component is replaced by a target within one frame", [this] {
+			UTestGrabTarget* OldTarget = AddGrabTarget(Actor);
+			UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtGrabTarget::StaticClass());
+
+			OtherComponent->DestroyComponent();
+			UTestGrabTarget* NewTarget = AddGrabTarget(Actor);
+
+			const FUxtInterfaceComponentArray& Components =
+				UUxtInputSubsystem::GetInterfaceComponents(Actor, UUxtGrabTarget::StaticClass());
+			TestEqual("Number of components", Components.Num(), 2);
+			TestTrue("Old target is cached", ContainsComponent(Components, OldTarget));
+			TestTrue("New target is cached", ContainsComponent(Components, NewTarget));
+		});
+
+		It("should collect components in worlds without a game instance", [this] {
+			UWorld* World = UxtTestUtils::CreateTestWorld();
+			AActor* EditorActor = World->SpawnActor<AActor>();
+			UTestGrabTarget* Target = AddGrabTarget(EditorActor);
+
+			const FUxtInterfaceComponentArray& Components =
+				UUxtInputSubsystem::GetInterfaceComponents(EditorActor, UUxtGrabTarget::StaticClass());
+			TestTrue("Target is found", ContainsComponent(Components, Target));
+			TestFalse("Event queue is disabled", UUxtInputSubsystem::IsEventQueueEnabled(EditorActor));
+
+			World->DestroyWorld(false);
+		});
+	});
+
+	Describe("Far target cache", [this] {
+		It("should find a far target added within one frame", [this] {
+			TestNull("No far target", UUxtInputSubsystem::GetFarTarget(Primitive));
+
+			UFarTargetTestComponent* Target = ReplaceComponentWithFarTarget(Actor, OtherComponent);
+			TestTrue("Far target is found", UUxtInputSubsystem::GetFarTarget(Primitive) == Target);
+		});
+
+		It("should find a far target swapped within one frame", [this] {
+			UFarTargetTestComponent* OldTarget = AddFarTarget(Actor);
+			TestTrue("Far target is found", UUxtInputSubsystem::GetFarTarget(Primitive) == OldTarget);
+
+			UFarTargetTestComponent* NewTarget = ReplaceComponentWithFarTarget(Actor, OldTarget);
+			TestTrue("New far target is found", UUxtInputSubsystem::GetFarTarget(Primitive) == NewTarget);
+		});
+
+		It("should update after invalidation", [this] {
+			UFarTargetTestComponent* Target = AddFarTarget(Actor);
+			TestTrue("Far target is found", UUxtInputSubsystem::GetFarTarget(Primitive) == Target);
+
+			Target->bIsFarFocusable = false;
+			UUxtInputSubsystem::InvalidateFarTargets(Actor);
+			TestNull("Far target is not focusable", UUxtInputSubsystem::GetFarTarget(Primitive));
+		});
+
+		It("should keep far targets of live primitives after garbage collection", [this] {
+			UFarTargetTestComponent* Target = AddFarTarget(Actor);
+			TestTrue("Far target is found", UUxtInputSubsystem::GetFarTarget(Primitive) == Target);
+
+			// Not invalidated, so the cached result is returned as long as the entry survives
+			Target->bIsFarFocusable = false;
+			FCoreUObjectDelegates::GetPostGarbageCollect().Broadcast();
+			TestTrue("Cached far target is kept", UUxtInputSubsystem::GetFarTarget(Primitive) == Target);
+		});
+	});
+
+	Describe("Event dispatch", [this] {
+		It("should raise events on a handler added within one frame", [this] {
+			// The pointer is only used as the event source, it does not need to be registered
+			UUxtFarPointerComponent* Pointer = NewObject<UUxtFarPointerComponent>(Actor);
+			UUxtInputSubsystem::RaiseEnterFarFocus(Primitive, Pointer);
+
+			UFarTargetTestComponent* Handler = ReplaceComponentWithFarTarget(Actor, OtherComponent);
+			UUxtInputSubsystem::RaiseEnterFarFocus(Primitive, Pointer);
+			TestEqual("Handler received the event", Handler->NumEnter, 1);
+		});
+
+		It("should not raise events on a handler removed within one frame", [this] {
+			UUxtFarPointerComponent* Pointer = NewObject<UUxtFarPointerComponent>(Actor);
+			UFarTargetTestComponent* OldHandler = AddFarTarget(Actor);
+			UUxtInputSubsystem::RaiseEnterFarFocus(Primitive, Pointer);
+			TestEqual("Handler received the event", OldHandler->NumEnter, 1);
+
+			UFarTargetTestComponent* NewHandler = ReplaceComponentWithFarTarget(Actor, OldHandler);
+			UUxtInputSubsystem::RaiseEnterFarFocus(Primitive, Pointer);
+			TestEqual("Removed handler did not receive the event", OldHandler->NumEnter, 1);
+			TestEqual("New handler received the event", NewHandler->NumEnter, 1);
+		});
+	});
+
+	Describe("Event queue", [this] {
+		BeforeEach([this] {
+			UWorld* World = UxtTestUtils::GetTestWorld();
+			FrameQueue.Init(World->GetGameInstance()->TimerManager);
+
+			AActor* PointerActor = World->SpawnActor<AActor>();
+			FarPointer = NewObject<UUxtFarPointerComponent>(PointerActor);
+			FarPointer->RegisterComponent();
+
+			UUxtInputSubsystem::SetEventQueueEnabled(World, true);
+		});
+
+		AfterEach([this] {
+			UUxtInputSubsystem::SetEventQueueEnabled(UxtTestUtils::GetTestWorld(), false);
+
+			if (IsValid(FarPointer))
+			{
+				FarPointer->GetOwner()->Destroy();
+			}
+			FarPointer = nullptr;
+
+			FrameQueue.Reset();
+		});
+
+		It("should dispatch queued events in order when flushed", [this] {
+			UFarTargetTestComponent* Handler = AddFarTarget(Actor);
+
+			UUxtInputSubsystem::RaiseEnterFarFocus(Primitive, FarPointer);
+			UUxtInputSubsystem::RaiseFarPressed(Primitive, FarPointer);
+			UUxtInputSubsystem::RaiseFarReleased(Primitive, FarPointer);
+			UUxtInputSubsystem::RaiseExitFarFocus(Primitive, FarPointer);
+			TestEqual("Events are queued", Handler->Events.Num(), 0);
+
+			GetInputSubsystem()->FlushEventQueue();
+
+			const TArray<EUxtInputEventType> Expected = {
+				EUxtInputEventType::EnterFarFocus, EUxtInputEventType::FarPressed, EUxtInputEventType::FarReleased,
+				EUxtInputEventType::ExitFarFocus};
+			TestTrue("Events are dispatched in order", Handler->Events == Expected);
+		});
+
+		It("should merge consecutive updates of the same pointer and target", [this] {
+			UFarTargetTestComponent* Handler = AddFarTarget(Actor);
+
+			UUxtInputSubsystem::RaiseEnterFarFocus(Primitive, FarPointer);
+			UUxtInputSubsystem::RaiseUpdatedFarFocus(Primitive, FarPointer);
+			UUxtInputSubsystem::RaiseUpdatedFarFocus(Primitive, FarPointer);
+			UUxtInputSubsystem::RaiseFarPressed(Primitive, FarPointer);
+			UUxtInputSubsystem::RaiseUpdatedFarFocus(Primitive, FarPointer);
+			UUxtInputSubsystem::RaiseUpdatedFarFocus(Primitive, FarPointer);
+			GetInputSubsystem()->FlushEventQueue();
+
+			const TArray<EUxtInputEventType> Expected = {
+				EUxtInputEventType::EnterFarFocus, EUxtInputEventType::UpdatedFarFocus, EUxtInputEventType::FarPressed,
+				EUxtInputEventType::UpdatedFarFocus};
+			TestTrue("Updates are merged up to the next event", Handler->Events == Expected);
+		});
+
+		It("should dispatch pending events when the queue is disabled", [this] {
+			UFarTargetTestComponent* Handler = AddFarTarget(Actor);
+
+			UUxtInputSubsystem::RaiseEnterFarFocus(Primitive, FarPointer);
+			TestEqual("Event is queued", Handler->NumEnter, 0);
+
+			UUxtInputSubsystem::SetEventQueueEnabled(Actor, false);
+			TestEqual("Event is dispatched", Handler->NumEnter, 1);
+
+			UUxtInputSubsystem::RaiseExitFarFocus(Primitive, FarPointer);
+			TestEqual("Events are dispatched immediately", Handler->NumExit, 1);
+		});
+
+		LatentIt("should flush the queue once per frame", [this](const FDoneDelegate& Done) {
+			UFarTargetTestComponent* Handler = AddFarTarget(Actor);
+			UUxtInputSubsystem::RaiseEnterFarFocus(Primitive, FarPointer);
+			TestEqual("Event is queued", Handler->NumEnter, 0);
+
+			FrameQueue.Enqueue([this, Handler, Done] {
+				TestEqual("Event is dispatched", Handler->NumEnter, 1);
+				Done.Execute();
+			});
+		});
+
+		It("should dispatch queued events of a pointer before it is destroyed", [this] {
+			UFarTargetTestComponent* Handler = AddFarTarget(Actor);
+
+			UUxtInputSubsystem::RaiseEnterFarFocus(Primitive, FarPointer);
+			UUxtInputSubsystem::RaiseFarPressed(Primitive, FarPointer);
+			FarPointer->DestroyComponent();
+
+			const TArray<EUxtInputEventType> Expected = {EUxtInputEventType::EnterFarFocus, EUxtInputEventType::FarPressed};
+			TestTrue("Events are dispatched", Handler->Events == Expected);
+
+			GetInputSubsystem()->FlushEventQueue();
+			TestTrue("Events are dispatched once", Handler->Events == Expected);
+		});
+
+		LatentIt("should dispatch teardown events of a destroyed near pointer", [this](const FDoneDelegate& Done) {
+			UxtTestUtils::EnableTestHandTracker();
+			UTestGrabTarget* Target = UxtTestUtils::CreateNearPointerGrabTarget(UxtTestUtils::GetTestWorld(), FVector(100, 0, 0));
+			UUxtNearPointerComponent* NearPointer =
+				UxtTestUtils::CreateNearPointer(UxtTestUtils::GetTestWorld(), TEXT("TestPointer"), FVector(100, 0, 0));
+
+			FrameQueue.Enqueue([] { UxtTestUtils::GetTestHandTracker().SetGrabbing(true); });
+			FrameQueue.Skip();
+			FrameQueue.Enqueue([this, Target, NearPointer] {
+				TestEqual("Target is focused", Target->BeginFocusCount, 1);
+				TestEqual("Target is grabbed", Target->BeginGrabCount, 1);
+
+				// End grab and focus exit are raised while the pointer is being destroyed
+				NearPointer->GetOwner()->Destroy();
+				TestEqual("Grab ended", Target->EndGrabCount, 1);
+				TestEqual("Focus ended", Target->EndFocusCount, 1);
+			});
+
+			FrameQueue.Enqueue([this, Target, Done] {
+				UxtTestUtils::DisableTestHandTracker();
+				Target->GetOwner()->Destroy();
+				Done.Execute();
+			});
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,184 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "ConstraintBucketTestComponents.h"
+#include "CoreMinimal.h"
+#include "FrameQueue.h"
+#include "UxtTestUtils.h"
+
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const FVector InitialHeadLocation(0, 50, 0);
+	const FVector MovedHeadLocation(100, 0, 0);
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	ManipulatorConstraintBucketsSpec, "UXTools.Manipulator.ConstraintBuckets",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext)
+
+/** Add a constraint that logs when it is applied. Constraints are registered, so they are found when auto-detecting. */
+UConstraintBucketTestConstraint* AddConstraint(EUxtTransformMode ConstraintType, bool bUsesHeadPose = false);
+
+/** Apply the constraints of one bucket and return the constraints that were applied, in order. */
+TArray<const UConstraintBucketTestConstraint*> Apply(EUxtTransformMode TransformMode, bool bIsOneHanded, bool bIsNear);
+
+AActor* Actor = nullptr;
+UConstraintBucketTestManipulator* Manipulator = nullptr;
+TArray<const UConstraintBucketTestConstraint*> ApplyLog;
+FFrameQueue FrameQueue;
+
+END_DEFINE_SPEC(ManipulatorConstraintBucketsSpec)
+
+UConstraintBucketTestConstraint* ManipulatorConstraintBucketsSpec::AddConstraint(EUxtTransformMode ConstraintType, bool bUsesHeadPose)
+{
+	UConstraintBucketTestConstraint* Constraint = NewObject<UConstraintBucketTestConstraint>(Actor);
+	Constraint->ConstraintType = ConstraintType;
+	Constraint->bUsesHeadPose = bUsesHeadPose;
+	Constraint->ApplyLog = &ApplyLog;
+	Constraint->RegisterComponent();
+	return Constraint;
+}
+
+TArray<const UConstraintBucketTestConstraint*> ManipulatorConstraintBucketsSpec::Apply(
+	EUxtTransformMode TransformMode, bool bIsOneHanded, bool bIsNear)
+{
+	ApplyLog.Reset();
+	FTransform Transform = Actor->GetActorTransform();
+	Manipulator->ApplyTestConstraints(Transform, TransformMode, bIsOneHanded, bIsNear);
+	return ApplyLog;
+}
+
+void ManipulatorConstraintBucketsSpec::Define()
+{
+	Describe("Constraint buckets", [this] {
+		BeforeEach([this] {
+			TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+
+			UWorld* World = UxtTestUtils::GetTestWorld();
+			FrameQueue.Init(&World->GetGameInstance()->GetTimerManager());
+
+			UxtTestUtils::SetTestHeadEnabled(true);
+			UxtTestUtils::SetTestHeadLocation(InitialHeadLocation);
+
+			Actor = World->SpawnActor<AActor>();
+			USceneComponent* Root = NewObject<USceneComponent>(Actor);
+			Actor->SetRootComponent(Root);
+			Root->RegisterComponent();
+
+			Manipulator = NewObject<UConstraintBucketTestManipulator>(Actor);
+			Manipulator->RegisterComponent();
+		});
+
+		AfterEach([this] {
+			FrameQueue.Reset();
+			UxtTestUtils::SetTestHeadEnabled(false);
+
+			Actor->Destroy();
+			Actor = nullptr;
+			Manipulator = nullptr;
+			ApplyLog.Empty();
+		});
+
+		It("should apply constraints of the matching bucket in order", [this] {
+			UConstraintBucketTestConstraint* First = AddConstraint(EUxtTransformMode::Translation);
+			UConstraintBucketTestConstraint* Rotation = AddConstraint(EUxtTransformMode::Rotation);
+			UConstraintBucketTestConstraint* Second = AddConstraint(EUxtTransformMode::Translation);
+			UConstraintBucketTestConstraint* TwoHanded = AddConstraint(EUxtTransformMode::Translation);
+			TwoHanded->HandType = static_cast<int32>(EUxtGrabMode::TwoHanded);
+			UConstraintBucketTestConstraint* Far = AddConstraint(EUxtTransformMode::Translation);
+			Far->InteractionMode = static_cast<int32>(EUxtInteractionMode::Far);
+			Manipulator->InitializeTestConstraints(Actor->GetRootComponent());
+
+			TArray<const UConstraintBucketTestConstraint*> Applied = Apply(EUxtTransformMode::Translation, true, true);
+			TestEqual("One handed near translation constraints", Applied.Num(), 2);
+			TestTrue("Constraints are applied in order", Applied.Num() == 2 && Applied[0] == First && Applied[1] == Second);
+
+			Applied = Apply(EUxtTransformMode::Translation, false, true);
+			TestEqual("Two handed near translation constraints", Applied.Num(), 3);
+			TestTrue("Two handed constraint is applied last", Applied.Num() == 3 && Applied[2] == TwoHanded);
+
+			Applied = Apply(EUxtTransformMode::Translation, true, false);
+			TestEqual("One handed far translation constraints", Applied.Num(), 3);
+			TestTrue("Far constraint is applied last", Applied.Num() == 3 && Applied[2] == Far);
+
+			Applied = Apply(EUxtTransformMode::Rotation, true, true);
+			TestTrue("Rotation constraint", Applied.Num() == 1 && Applied[0] == Rotation);
+
+			TestEqual("Scaling constraints", Apply(EUxtTransformMode::Scaling, true, true).Num(), 0);
+		});
+
+		It("should recompile buckets when a constraint is added or removed", [this] {
+			UConstraintBucketTestConstraint* First = AddConstraint(EUxtTransformMode::Translation);
+			Manipulator->InitializeTestConstraints(Actor->GetRootComponent());
+			TestEqual("Initial constraints", Apply(EUxtTransformMode::Translation, true, true).Num(), 1);
+
+			// Auto-detected constraints are otherwise updated on tick, enabling detection updates them immediately
+			UConstraintBucketTestConstraint* Second = AddConstraint(EUxtTransformMode::Translation);
+			Manipulator->SetAutoDetectConstraints(true);
+			TArray<const UConstraintBucketTestConstraint*> Applied = Apply(EUxtTransformMode::Translation, true, true);
+			TestTrue("Added constraint is applied", Applied.Num() == 2 && Applied[1] == Second);
+
+			Manipulator->SetAutoDetectConstraints(false);
+			FComponentReference FirstReference;
+			FirstReference.OverrideComponent = First;
+			Manipulator->AddConstraint(FirstReference);
+			Applied = Apply(EUxtTransformMode::Translation, true, true);
+			TestTrue("Only selected constraint is applied", Applied.Num() == 1 && Applied[0] == First);
+
+			Manipulator->RemoveConstraint(FirstReference);
+			TestEqual("Removed constraint is not applied", Apply(EUxtTransformMode::Translation, true, true).Num(), 0);
+		});
+
+		LatentIt("should fetch the head pose once per frame", [this](const FDoneDelegate& Done) {
+			FrameQueue.Enqueue([this] {
+				UConstraintBucketTestConstraint* Translation = AddConstraint(EUxtTransformMode::Translation, true);
+				UConstraintBucketTestConstraint* Rotation = AddConstraint(EUxtTransformMode::Rotation, true);
+				UConstraintBucketTestConstraint* NoHeadPose = AddConstraint(EUxtTransformMode::Translation);
+				Manipulator->InitializeTestConstraints(Actor->GetRootComponent());
+
+				Apply(EUxtTransformMode::Translation, true, true);
+				TestEqual("Head pose is passed", Translation->LastHeadPose.GetLocation(), InitialHeadLocation);
+				TestEqual("Constraint without head pose keeps its default", NoHeadPose->LastHeadPose.GetLocation(), FVector::ZeroVector);
+
+				// Head pose is fetched once for all buckets, later changes in the same frame are not seen
+				UxtTestUtils::SetTestHeadLocation(MovedHeadLocation);
+				Apply(EUxtTransformMode::Rotation, true, true);
+				TestEqual("Head pose is not fetched again in the same frame", Rotation->LastHeadPose.GetLocation(), InitialHeadLocation);
+			});
+			FrameQueue.Enqueue([this] {
+				const TArray<const UConstraintBucketTestConstraint*> Applied = Apply(EUxtTransformMode::Rotation, true, true);
+				TestTrue(
+					"Head pose is fetched in the next frame",
+					Applied.Num() == 1 && Applied[0]->LastHeadPose.GetLocation().Equals(MovedHeadLocation));
+			});
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+
+		LatentIt("should fetch the head pose when applied without a manipulator", [this](const FDoneDelegate& Done) {
+			UConstraintBucketTestConstraint* Constraint = AddConstraint(EUxtTransformMode::Translation, true);
+
+			FrameQueue.Enqueue([this, Constraint] {
+				FTransform Transform = Actor->GetActorTransform();
+				Constraint->ApplyConstraint(Transform);
+				TestEqual("Head pose is fetched", Constraint->LastHeadPose.GetLocation(), InitialHeadLocation);
+
+				UxtTestUtils::SetTestHeadLocation(MovedHeadLocation);
+			});
+			FrameQueue.Enqueue([this, Constraint] {
+				FTransform Transform = Actor->GetActorTransform();
+				Constraint->ApplyConstraint(Transform);
+				TestEqual("Head pose is fetched again in the next frame", Constraint->LastHeadPose.GetLocation(), MovedHeadLocation);
+			});
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
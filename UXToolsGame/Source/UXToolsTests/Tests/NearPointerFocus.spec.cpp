@@ -0,0 +1,177 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "FrameQueue.h"
+#include "UxtTestHandTracker.h"
+#include "UxtTestTargetComponent.h"
+#include "UxtTestUtils.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Input/UxtNearPointerComponent.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Cubes with a side length of 30, all targets are within the proximity radius of a pointer at the origin
+	const float TargetScale = 0.3f;
+	const FVector NearLocation(0, 20, 0);
+	const FVector FarLocation(25, 0, 0);
+	const FVector OutOfRangeLocation(0, 0, 100);
+	const FString TargetMesh = TEXT("/Engine/BasicShapes/Cube.Cube");
+
+	/** Add a second cube to the target's actor, colliding like the first one. */
+	UStaticMeshComponent* AddTargetMesh(AActor* Actor, const FVector& Location)
+	{
+		UStaticMeshComponent* Mesh = NewObject<UStaticMeshComponent>(Actor);
+		Mesh->SetupAttachment(Actor->GetRootComponent());
+		Mesh->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		Mesh->SetCollisionProfileName(TEXT("UI"));
+		Mesh->SetGenerateOverlapEvents(true);
+		Mesh->SetStaticMesh(LoadObject<UStaticMesh>(Actor, *TargetMesh));
+		Mesh->SetRelativeScale3D(FVector(TargetScale));
+		Mesh->RegisterComponent();
+		Mesh->SetWorldLocation(Location);
+		return Mesh;
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	NearPointerFocusSpec, "UXTools.NearPointer.Focus",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext)
+
+UTestGrabTarget* AddGrabTarget(const FVector& Location);
+UTestPokeTarget* AddPokeTarget(const FVector& Location);
+
+UUxtNearPointerComponent* Pointer = nullptr;
+TArray<AActor*> TargetActors;
+FFrameQueue FrameQueue;
+
+END_DEFINE_SPEC(NearPointerFocusSpec)
+
+UTestGrabTarget* NearPointerFocusSpec::AddGrabTarget(const FVector& Location)
+{
+	UTestGrabTarget* Target = UxtTestUtils::CreateNearPointerGrabTarget(UxtTestUtils::GetTestWorld(), Location, TargetMesh, TargetScale);
+	TargetActors.Add(Target->GetOwner());
+	return Target;
+}
+
+UTestPokeTarget* NearPointerFocusSpec::AddPokeTarget(const FVector& Location)
+{
+	UTestPokeTarget* Target = UxtTestUtils::CreateNearPointerPokeTarget(UxtTestUtils::GetTestWorld(), Location, TargetMesh, TargetScale);
+	TargetActors.Add(Target->GetOwner());
+	return Target;
+}
+
+void NearPointerFocusSpec::Define()
+{
+	Describe("Closest target selection", [this] {
+		BeforeEach([this] {
+			TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+			UWorld* World = UxtTestUtils::GetTestWorld();
+			FrameQueue.Init(World->GetGameInstance()->TimerManager);
+			UxtTestUtils::EnableTestHandTracker();
+
+			Pointer = UxtTestUtils::CreateNearPointer(World, TEXT("TestPointer"), FVector::ZeroVector);
+		});
+
+		AfterEach([this] {
+			UxtTestUtils::DisableTestHandTracker();
+
+			Pointer->GetOwner()->Destroy();
+			Pointer = nullptr;
+
+			for (AActor* Actor : TargetActors)
+			{
+				Actor->Destroy();
+			}
+			TargetActors.Empty();
+
+			FrameQueue.Reset();
+		});
+
+		LatentIt("should focus the closest grab target", [this](const FDoneDelegate& Done) {
+			UTestGrabTarget* FarTarget = AddGrabTarget(FarLocation);
+			UTestGrabTarget* NearTarget = AddGrabTarget(NearLocation);
+			AddGrabTarget(OutOfRangeLocation);
+
+			FrameQueue.Skip();
+			FrameQueue.Enqueue([this, FarTarget, NearTarget, Done] {
+				FVector ClosestPoint, Normal;
+				TestTrue("Closest target is focused", Pointer->GetFocusedGrabTarget(ClosestPoint, Normal) == NearTarget);
+				TestEqual("Closest point distance", ClosestPoint.Size(), 5.0f, 0.01f);
+				TestEqual("Closest target entered focus", NearTarget->BeginFocusCount, 1);
+				TestEqual("Other target did not enter focus", FarTarget->BeginFocusCount, 0);
+				Done.Execute();
+			});
+		});
+
+		LatentIt("should select grab and poke focus independently", [this](const FDoneDelegate& Done) {
+			UTestGrabTarget* GrabTarget = AddGrabTarget(FarLocation);
+			UTestPokeTarget* PokeTarget = AddPokeTarget(NearLocation);
+
+			FrameQueue.Skip();
+			FrameQueue.Enqueue([this, GrabTarget, PokeTarget, Done] {
+				FVector ClosestPoint, Normal;
+				TestTrue("Grab target is focused", Pointer->GetFocusedGrabTarget(ClosestPoint, Normal) == GrabTarget);
+				TestTrue("Poke target is focused", Pointer->GetFocusedPokeTarget(ClosestPoint, Normal) == PokeTarget);
+				Done.Execute();
+			});
+		});
+
+		LatentIt("should focus a primitive with both grab and poke targets for both", [this](const FDoneDelegate& Done) {
+			UTestGrabTarget* GrabTarget = AddGrabTarget(NearLocation);
+			UTestPokeTarget* PokeTarget = NewObject<UTestPokeTarget>(GrabTarget->GetOwner());
+			PokeTarget->RegisterComponent();
+			AddGrabTarget(FarLocation);
+			AddPokeTarget(FarLocation);
+
+			FrameQueue.Skip();
+			FrameQueue.Enqueue([this, GrabTarget, PokeTarget, Done] {
+				FVector ClosestPoint, Normal;
+				TestTrue("Grab target is focused", Pointer->GetFocusedGrabTarget(ClosestPoint, Normal) == GrabTarget);
+				TestTrue("Poke target is focused", Pointer->GetFocusedPokeTarget(ClosestPoint, Normal) == PokeTarget);
+
+				UPrimitiveComponent* GrabPrimitive = Pointer->GetFocusedGrabPrimitive(ClosestPoint, Normal);
+				UPrimitiveComponent* PokePrimitive = Pointer->GetFocusedPokePrimitive(ClosestPoint, Normal);
+				TestNotNull("Primitive is focused", GrabPrimitive);
+				TestTrue("Same primitive is focused", GrabPrimitive == PokePrimitive);
+				Done.Execute();
+			});
+		});
+
+		LatentIt("should focus the closest primitive of a target", [this](const FDoneDelegate& Done) {
+			UTestGrabTarget* Target = AddGrabTarget(FarLocation);
+			UStaticMeshComponent* NearMesh = AddTargetMesh(Target->GetOwner(), NearLocation);
+
+			FrameQueue.Skip();
+			FrameQueue.Enqueue([this, Target, NearMesh, Done] {
+				FVector ClosestPoint, Normal;
+				TestTrue("Target is focused", Pointer->GetFocusedGrabTarget(ClosestPoint, Normal) == Target);
+				TestTrue("Closest primitive is focused", Pointer->GetFocusedGrabPrimitive(ClosestPoint, Normal) == NearMesh);
+				TestEqual("Target entered focus once", Target->BeginFocusCount, 1);
+				Done.Execute();
+			});
+		});
+
+		LatentIt("should not focus targets out of range", [this](const FDoneDelegate& Done) {
+			AddGrabTarget(OutOfRangeLocation);
+			AddPokeTarget(OutOfRangeLocation);
+
+			FrameQueue.Skip();
+			FrameQueue.Enqueue([this, Done] {
+				FVector ClosestPoint, Normal;
+				TestNull("No grab target is focused", Pointer->GetFocusedGrabTarget(ClosestPoint, Normal));
+				TestNull("No poke target is focused", Pointer->GetFocusedPokeTarget(ClosestPoint, Normal));
+				Done.Execute();
+			});
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,201 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "UxtTestAllocationCounter.h"
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Utils/UxtOneEuroFilter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const float SampleInterval = 1.0f / 60.0f;
+	const int32 NumTraceFrames = 600;
+	const int32 NumBenchmarkFrames = 1000;
+	const int32 TraceSeed = 1234;
+
+	// Hand tracking jitter of a few millimeters, in centimeters
+	const float PositionJitter = 0.3f;
+	const float RotationJitter = FMath::DegreesToRadians(0.5f);
+
+	/** Hand trace sample: a sinusoidal sweep along X with tracking jitter from a seeded stream. */
+	FVector GetHandTracePosition(FRandomStream& Jitter, int32 Frame, float Amplitude)
+	{
+		const float Time = Frame * SampleInterval;
+		const FVector Motion(Amplitude * FMath::Sin(2.0f * PI * Time), 0, 0);
+		return Motion + Jitter.GetUnitVector() * Jitter.FRandRange(0.0f, PositionJitter);
+	}
+
+	FQuat GetHandTraceRotation(FRandomStream& Jitter, int32 Frame, float Amplitude)
+	{
+		const float Time = Frame * SampleInterval;
+		const FQuat Motion(FVector::UpVector, Amplitude * FMath::Sin(2.0f * PI * Time));
+		return Motion * FQuat(Jitter.GetUnitVector(), Jitter.FRandRange(0.0f, RotationJitter));
+	}
+
+	/** Mean distance between the sample and the noise-free trace, ignoring the first second while the filter settles. */
+	float GetMeanPositionError(const FUxtOneEuroFilterSettings& Settings, float Amplitude, bool bFilter)
+	{
+		FUxtOneEuroVectorFilter Filter;
+		FRandomStream Jitter(TraceSeed);
+		float TotalError = 0.0f;
+		int32 NumErrors = 0;
+
+		for (int32 Frame = 0; Frame < NumTraceFrames; ++Frame)
+		{
+			const FVector Sample = GetHandTracePosition(Jitter, Frame, Amplitude);
+			const FVector Output = bFilter ? Filter.Filter(Sample, SampleInterval, Settings) : Sample;
+
+			if (Frame >= 60)
+			{
+				const FVector Expected(Amplitude * FMath::Sin(2.0f * PI * Frame * SampleInterval), 0, 0);
+				TotalError += FVector::Dist(Output, Expected);
+				++NumErrors;
+			}
+		}
+
+		return TotalError / NumErrors;
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	OneEuroFilterSpec, "UXTools.OneEuroFilter", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+FUxtOneEuroFilterSettings LocationSettings = FUxtOneEuroFilterSettings(2.0f, 0.05f, 1.0f);
+FUxtOneEuroFilterSettings RotationSettings = FUxtOneEuroFilterSettings(2.0f, 0.5f, 1.0f);
+
+END_DEFINE_SPEC(OneEuroFilterSpec)
+
+void OneEuroFilterSpec::Define()
+{
+	Describe("Scalar filter", [this] {
+		It("should pass the first sample through", [this] {
+			FUxtOneEuroFilter Filter;
+			TestFalse("Filter has value", Filter.HasValue());
+			TestEqual("First sample", Filter.Filter(5.0f, SampleInterval, LocationSettings), 5.0f);
+			TestTrue("Filter has value", Filter.HasValue());
+		});
+
+		It("should keep its value without elapsed time", [this] {
+			FUxtOneEuroFilter Filter;
+			Filter.Reset(1.0f);
+			TestEqual("Value", Filter.Filter(10.0f, 0.0f, LocationSettings), 1.0f);
+		});
+
+		It("should converge to a constant signal", [this] {
+			FUxtOneEuroFilter Filter;
+			Filter.Reset(0.0f);
+
+			float Value = 0.0f;
+			for (int32 Frame = 0; Frame < NumTraceFrames; ++Frame)
+			{
+				Value = Filter.Filter(10.0f, SampleInterval, LocationSettings);
+			}
+			TestEqual("Value", Value, 10.0f, KINDA_SMALL_NUMBER * 10);
+		});
+	});
+
+	Describe("Vector filter", [this] {
+		It("should reduce jitter at rest", [this] {
+			const float RawError = GetMeanPositionError(LocationSettings, 0.0f, false);
+			const float FilteredError = GetMeanPositionError(LocationSettings, 0.0f, true);
+
+			AddInfo(FString::Printf(TEXT("Jitter at rest: %.4f raw, %.4f filtered"), RawError, FilteredError));
+			TestTrue("Jitter is halved", FilteredError < 0.5f * RawError);
+		});
+
+		It("should lag less than a fixed cutoff filter during fast motion", [this] {
+			// Sweep 20cm at 1Hz, peaking at about 125cm/s
+			const FUxtOneEuroFilterSettings FixedSettings(LocationSettings.MinCutoff, 0.0f, LocationSettings.DerivativeCutoff);
+			const float FixedError = GetMeanPositionError(FixedSettings, 20.0f, true);
+			const float AdaptiveError = GetMeanPositionError(LocationSettings, 20.0f, true);
+
+			AddInfo(FString::Printf(TEXT("Error during fast motion: %.4f fixed, %.4f adaptive"), FixedError, AdaptiveError));
+			TestTrue("Adaptive filter lags less", AdaptiveError < 0.5f * FixedError);
+		});
+
+		It("should be deterministic", [this] {
+			FUxtOneEuroVectorFilter FilterA;
+			FUxtOneEuroVectorFilter FilterB;
+			FRandomStream JitterA(TraceSeed);
+			FRandomStream JitterB(TraceSeed);
+
+			bool bIdentical = true;
+			for (int32 Frame = 0; Frame < NumTraceFrames && bIdentical; ++Frame)
+			{
+				const FVector OutputA = FilterA.Filter(GetHandTracePosition(JitterA, Frame, 20.0f), SampleInterval, LocationSettings);
+				const FVector OutputB = FilterB.Filter(GetHandTracePosition(JitterB, Frame, 20.0f), SampleInterval, LocationSettings);
+				bIdentical = FMemory::Memcmp(&OutputA, &OutputB, sizeof(FVector)) == 0;
+			}
+			TestTrue("Outputs are identical", bIdentical);
+		});
+	});
+
+	Describe("Quaternion filter", [this] {
+		It("should reduce jitter at rest and stay normalized", [this] {
+			FUxtOneEuroQuatFilter Filter;
+			FRandomStream Jitter(TraceSeed);
+			float RawError = 0.0f;
+			float FilteredError = 0.0f;
+			bool bNormalized = true;
+
+			for (int32 Frame = 0; Frame < NumTraceFrames; ++Frame)
+			{
+				const FQuat Sample = GetHandTraceRotation(Jitter, Frame, 0.0f);
+				const FQuat Output = Filter.Filter(Sample, SampleInterval, RotationSettings);
+				bNormalized &= Output.IsNormalized();
+
+				if (Frame >= 60)
+				{
+					RawError += Sample.AngularDistance(FQuat::Identity);
+					FilteredError += Output.AngularDistance(FQuat::Identity);
+				}
+			}
+
+			AddInfo(FString::Printf(TEXT("Rotation jitter at rest: %.5f raw, %.5f filtered"), RawError, FilteredError));
+			TestTrue("Jitter is halved", FilteredError < 0.5f * RawError);
+			TestTrue("Output is normalized", bNormalized);
+		});
+
+		It("should follow the shortest arc", [this] {
+			FUxtOneEuroQuatFilter Filter;
+			Filter.Reset(FQuat::Identity);
+
+			// Same rotation as a small turn about Z, but in the opposite hemisphere
+			const FQuat Sample = FQuat(FVector::UpVector, FMath::DegreesToRadians(10.0f)) * -1.0f;
+			const FQuat Output = Filter.Filter(Sample, SampleInterval, RotationSettings);
+			TestTrue("Output turns less than the sample", Output.AngularDistance(FQuat::Identity) < FMath::DegreesToRadians(10.0f));
+		});
+	});
+
+	It("should not allocate", [this] {
+		FUxtOneEuroVectorFilter LocationFilter;
+		FUxtOneEuroQuatFilter RotationFilter;
+		FRandomStream Jitter(TraceSeed);
+		int32 NumAllocations;
+		double Elapsed;
+		{
+			FUxtScopedAllocationCounter AllocationCounter;
+			const double StartTime = FPlatformTime::Seconds();
+
+			for (int32 Frame = 0; Frame < NumBenchmarkFrames; ++Frame)
+			{
+				LocationFilter.Filter(GetHandTracePosition(Jitter, Frame, 20.0f), SampleInterval, LocationSettings);
+				RotationFilter.Filter(GetHandTraceRotation(Jitter, Frame, 1.0f), SampleInterval, RotationSettings);
+			}
+
+			Elapsed = FPlatformTime::Seconds() - StartTime;
+			NumAllocations = AllocationCounter.GetNumAllocations();
+		}
+
+		AddInfo(FString::Printf(
+			TEXT("%d filtered poses: %.3f us per frame, %d allocations"), NumBenchmarkFrames, Elapsed * 1e6 / NumBenchmarkFrames,
+			NumAllocations));
+		TestEqual("Allocations", NumAllocations, 0);
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,126 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CoreMinimal.h"
+#include "UxtTestAllocationCounter.h"
+
+#include "HandTracking/UxtPosePredictor.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const float SampleInterval = 1.0f / 60.0f;
+	const int32 NumBenchmarkFrames = 1000;
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	PosePredictorSpec, "UXTools.PosePredictor", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+FUxtPosePredictor Predictor;
+
+END_DEFINE_SPEC(PosePredictorSpec)
+
+void PosePredictorSpec::Define()
+{
+	BeforeEach([this] { Predictor.Reset(); });
+
+	It("should not predict without samples", [this] {
+		FQuat Orientation;
+		FVector Position;
+		TestFalse("Prediction available", Predictor.Predict(SampleInterval, Orientation, Position));
+	});
+
+	It("should return the latest pose until velocity is known", [this] {
+		Predictor.AddSample(FQuat::Identity, FVector(10, 0, 0), 0.0);
+
+		FQuat Orientation;
+		FVector Position;
+		TestTrue("Prediction available", Predictor.Predict(SampleInterval, Orientation, Position));
+		TestEqual("Position", Position, FVector(10, 0, 0));
+		TestEqual("Orientation", Orientation, FQuat::Identity);
+	});
+
+	It("should extrapolate at constant velocity", [this] {
+		// Move 1 unit and turn 1 degree about Z per sample, over more samples than the window holds
+		for (int32 Index = 0; Index < 2 * FUxtPosePredictor::WindowSize; ++Index)
+		{
+			const FQuat Orientation(FVector::UpVector, FMath::DegreesToRadians(static_cast<float>(Index)));
+			Predictor.AddSample(Orientation, FVector(Index, 0, 0), Index * SampleInterval);
+		}
+
+		const int32 LastIndex = 2 * FUxtPosePredictor::WindowSize - 1;
+		FQuat Orientation;
+		FVector Position;
+		Predictor.Predict(2 * SampleInterval, Orientation, Position);
+		TestEqual("Position", Position, FVector(LastIndex + 2, 0, 0), KINDA_SMALL_NUMBER * 100);
+		TestTrue(
+			"Orientation",
+			Orientation.Equals(FQuat(FVector::UpVector, FMath::DegreesToRadians(LastIndex + 2.0f)), KINDA_SMALL_NUMBER * 10));
+	});
+
+	It("should ignore samples that are not newer than the last one", [this] {
+		Predictor.AddSample(FQuat::Identity, FVector::ZeroVector, 0.0);
+		Predictor.AddSample(FQuat::Identity, FVector(1, 0, 0), SampleInterval);
+		Predictor.AddSample(FQuat::Identity, FVector(100, 0, 0), SampleInterval);
+
+		FQuat Orientation;
+		FVector Position;
+		Predictor.Predict(SampleInterval, Orientation, Position);
+		TestEqual("Position", Position, FVector(2, 0, 0), KINDA_SMALL_NUMBER * 100);
+	});
+
+	It("should ignore repeated poses", [this] {
+		// Tracking updates at half the frame rate, the runtime reports the same pose again in between
+		Predictor.AddSample(FQuat::Identity, FVector::ZeroVector, 0.0);
+		Predictor.AddSample(FQuat::Identity, FVector(1, 0, 0), SampleInterval);
+		Predictor.AddSample(FQuat::Identity, FVector(1, 0, 0), 2 * SampleInterval);
+
+		FQuat Orientation;
+		FVector Position;
+		Predictor.Predict(SampleInterval, Orientation, Position);
+		TestEqual("Position", Position, FVector(3, 0, 0), KINDA_SMALL_NUMBER * 100);
+	});
+
+	It("should not extrapolate a pose that is held still", [this] {
+		Predictor.AddSample(FQuat::Identity, FVector::ZeroVector, 0.0);
+		Predictor.AddSample(FQuat::Identity, FVector(1, 0, 0), SampleInterval);
+		for (int32 Index = 2; Index * SampleInterval <= FUxtPosePredictor::MaxSampleAge + 2 * SampleInterval; ++Index)
+		{
+			Predictor.AddSample(FQuat::Identity, FVector(1, 0, 0), Index * SampleInterval);
+		}
+
+		FQuat Orientation;
+		FVector Position;
+		Predictor.Predict(SampleInterval, Orientation, Position);
+		TestEqual("Position", Position, FVector(1, 0, 0));
+	});
+
+	It("should not allocate", [this] {
+		FQuat Orientation;
+		FVector Position;
+		int32 NumAllocations;
+		double Elapsed;
+		{
+			FUxtScopedAllocationCounter AllocationCounter;
+			const double StartTime = FPlatformTime::Seconds();
+
+			for (int32 Frame = 0; Frame < NumBenchmarkFrames; ++Frame)
+			{
+				Predictor.AddSample(FQuat(FVector::UpVector, Frame * 0.01f), FVector(Frame, 0, 0), Frame * SampleInterval);
+				Predictor.Predict(SampleInterval, Orientation, Position);
+			}
+
+			Elapsed = FPlatformTime::Seconds() - StartTime;
+			NumAllocations = AllocationCounter.GetNumAllocations();
+		}
+
+		AddInfo(FString::Printf(
+			TEXT("%d predictions: %.3f us per frame, %d allocations"), NumBenchmarkFrames, Elapsed * 1e6 / NumBenchmarkFrames,
+			NumAllocations));
+		TestEqual("Allocations", NumAllocations, 0);
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,70 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+
+#include "ScrollingCollectionTestDataSource.generated.h"
+
+/**
+ * Movable actor used as an item of virtualized scrolling collections.
+ */
+UCLASS(ClassGroup = "UXToolsTests")
+class AScrollingCollectionTestItem : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AScrollingCollectionTestItem()
+	{
+		RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+		RootComponent->SetMobility(EComponentMobility::Movable);
+	}
+
+	/** Index of the item last bound to this actor. */
+	int32 ItemIndex = INDEX_NONE;
+};
+
+/**
+ * Data source for virtualized scrolling collection tests that records bound items.
+ */
+UCLASS(ClassGroup = "UXToolsTests")
+class UScrollingCollectionTestDataSource : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(Category = "UXToolsTests")
+	int32 GetItemCount() { return NumItems; }
+
+	UFUNCTION(Category = "UXToolsTests")
+	void BindItem(int32 ItemIndex, AActor* ItemActor)
+	{
+		if (AScrollingCollectionTestItem* Item = Cast<AScrollingCollectionTestItem>(ItemActor))
+		{
+			Item->ItemIndex = ItemIndex;
+		}
+		ItemActors.Add(ItemActor);
+		BindCount++;
+	}
+
+	/** Sorts items in descending order of their index. */
+	UFUNCTION(Category = "UXToolsTests")
+	float GetSortKey(const AActor* Actor)
+	{
+		SortKeyCount++;
+		const AScrollingCollectionTestItem* Item = Cast<AScrollingCollectionTestItem>(Actor);
+		return Item ? -Item->ItemIndex : 0.0f;
+	}
+
+	int32 NumItems = 0;
+	int32 BindCount = 0;
+	int32 SortKeyCount = 0;
+
+	/** All actors that have been bound to an item. */
+	TSet<AActor*> ItemActors;
+};
@@ -0,0 +1,393 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Engine.h"
+#include "FrameQueue.h"
+#include "ScrollingCollectionTestDataSource.h"
+#include "UxtTestUtils.h"
+
+#include "Controls/UxtScrollingObjectCollection.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const int32 NumTestItems = 1000;
+	const int32 TestTiers = 2;
+	const int32 TestViewableArea = 4;
+	const int32 TestMargin = 1;
+	const int32 NumBenchmarkFrames = 200;
+	const float BenchmarkDeltaTime = 1.0f / 60.0f;
+	const int32 NumBouncingItems = 10;
+
+	// Exactly representable, so that frame times add up to whole steps without rounding
+	const float TestScrollTimeStep = 1.0f / 64.0f;
+
+	UUxtScrollingObjectCollection* CreateTestCollection()
+	{
+		UWorld* World = UxtTestUtils::GetTestWorld();
+		AActor* Actor = World->SpawnActor<AActor>();
+
+		UUxtScrollingObjectCollection* Collection = NewObject<UUxtScrollingObjectCollection>(Actor);
+		Collection->SetTiers(TestTiers);
+		Collection->ViewableArea = TestViewableArea;
+		Collection->VirtualizationMargin = TestMargin;
+		Actor->SetRootComponent(Collection);
+		Collection->RegisterComponent();
+
+		return Collection;
+	}
+
+	/** Tick the collection directly, without ticking the world. */
+	void TickCollection(UUxtScrollingObjectCollection* Collection, float DeltaTime)
+	{
+		static_cast<UActorComponent*>(Collection)->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+	}
+
+	/** Scroll by one row and tick the collection. */
+	void TickScrollFrame(UUxtScrollingObjectCollection* Collection)
+	{
+		Collection->MoveByItems(1, false, FUxtScrollingObjectCollectionOnPaginationEnd());
+
+		// Non-animated pagination completes on the next tick
+		TickCollection(Collection, BenchmarkDeltaTime);
+	}
+
+	/** Create a virtualized collection that is scrolled beyond the end of its items, so that it bounces back. */
+	UUxtScrollingObjectCollection* CreateBouncingCollection(UScrollingCollectionTestDataSource* DataSource)
+	{
+		UUxtScrollingObjectCollection* Collection = CreateTestCollection();
+		Collection->ScrollTimeStep = TestScrollTimeStep;
+
+		FUxtScrollingObjectCollectionGetItemCount GetItemCount;
+		GetItemCount.BindDynamic(DataSource, &UScrollingCollectionTestDataSource::GetItemCount);
+		FUxtScrollingObjectCollectionBindItem BindItem;
+		BindItem.BindDynamic(DataSource, &UScrollingCollectionTestDataSource::BindItem);
+		DataSource->NumItems = NumTestItems;
+		Collection->SetDataSource(AScrollingCollectionTestItem::StaticClass(), GetItemCount, BindItem);
+
+		Collection->PageBy(NumTestItems, false, FUxtScrollingObjectCollectionOnPaginationEnd());
+		TickCollection(Collection, TestScrollTimeStep);
+
+		DataSource->NumItems = NumBouncingItems;
+		Collection->RefreshDataSource();
+		return Collection;
+	}
+
+	/** Visibility update that used to run on every tick, touching all attached actors. */
+	void SetAllItemsVisibility(const TArray<AActor*>& Items, int32 FirstVisible, int32 FirstNotVisible)
+	{
+		for (int32 Index = 0; Index < Items.Num(); ++Index)
+		{
+			const bool bHidden = (Index < FirstVisible || Index >= FirstNotVisible);
+			Items[Index]->SetActorHiddenInGame(bHidden);
+			Items[Index]->SetActorTickEnabled(!bHidden);
+			Items[Index]->SetActorEnableCollision(!bHidden);
+#if WITH_EDITORONLY_DATA
+			Items[Index]->SetIsTemporarilyHiddenInEditor(bHidden);
+#endif // WITH_EDITORONLY_DATA
+		}
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	ScrollingObjectCollectionSpec, "UXTools.ScrollingObjectCollection",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+FFrameQueue FrameQueue;
+
+UUxtScrollingObjectCollection* Collection;
+UUxtScrollingObjectCollection* ReferenceCollection;
+UScrollingCollectionTestDataSource* DataSource;
+
+END_DEFINE_SPEC(ScrollingObjectCollectionSpec)
+
+void ScrollingObjectCollectionSpec::Define()
+{
+	Describe("Virtualized collection", [this] {
+		BeforeEach([this] {
+			TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+
+			UWorld* World = UxtTestUtils::GetTestWorld();
+			FrameQueue.Init(&World->GetGameInstance()->GetTimerManager());
+
+			Collection = CreateTestCollection();
+
+			DataSource = NewObject<UScrollingCollectionTestDataSource>();
+			DataSource->AddToRoot();
+			DataSource->NumItems = NumTestItems;
+
+			FUxtScrollingObjectCollectionGetItemCount GetItemCount;
+			GetItemCount.BindDynamic(DataSource, &UScrollingCollectionTestDataSource::GetItemCount);
+			FUxtScrollingObjectCollectionBindItem BindItem;
+			BindItem.BindDynamic(DataSource, &UScrollingCollectionTestDataSource::BindItem);
+			Collection->SetDataSource(AScrollingCollectionTestItem::StaticClass(), GetItemCount, BindItem);
+		});
+
+		AfterEach([this] {
+			FrameQueue.Reset();
+
+			Collection->GetOwner()->Destroy();
+			Collection = nullptr;
+
+			DataSource->RemoveFromRoot();
+			DataSource = nullptr;
+		});
+
+		It("should only bind items in view", [this] {
+			const int32 NumBoundItems = (TestViewableArea + TestMargin) * TestTiers;
+
+			TestTrue("Collection is virtualized", Collection->IsVirtualized());
+			TestEqual("Items in view and margin are bound", DataSource->BindCount, NumBoundItems);
+			TestEqual("One actor per bound item", DataSource->ItemActors.Num(), NumBoundItems);
+			TestNotNull("Last item in the margin has an actor", Collection->GetItemActor(NumBoundItems - 1));
+			TestNull("Item after the margin has no actor", Collection->GetItemActor(NumBoundItems));
+			TestNull("Last item has no actor", Collection->GetItemActor(NumTestItems - 1));
+		});
+
+		LatentIt("should recycle actors when scrolling", [this](const FDoneDelegate& Done) {
+			FrameQueue.Enqueue([this] { Collection->PageBy(1, false, FUxtScrollingObjectCollectionOnPaginationEnd()); });
+			FrameQueue.Skip();
+			FrameQueue.Enqueue([this] {
+				const int32 FirstVisibleItem = TestViewableArea * TestTiers;
+				const AScrollingCollectionTestItem* Item = Cast<AScrollingCollectionTestItem>(Collection->GetItemActor(FirstVisibleItem));
+				TestNotNull("First visible item has an actor", Item);
+				if (Item)
+				{
+					TestEqual("Actor is bound to the first visible item", Item->ItemIndex, FirstVisibleItem);
+					TestFalse("First visible item is shown", Item->IsHidden());
+				}
+				TestNull("Items before the margin have no actor", Collection->GetItemActor(0));
+
+				// Actors of items that scrolled out of view are reused, only the larger bound range needs new actors
+				const int32 MaxBoundItems = (TestViewableArea + 2 * TestMargin) * TestTiers;
+				TestTrue("Actors are recycled", DataSource->ItemActors.Num() <= MaxBoundItems);
+			});
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+
+		It("should rebind items when the data source is refreshed", [this] {
+			DataSource->NumItems = 3;
+			Collection->RefreshDataSource();
+
+			TestNotNull("Remaining item has an actor", Collection->GetItemActor(2));
+			TestNull("Removed item has no actor", Collection->GetItemActor(3));
+			TestEqual("No new actors needed", DataSource->ItemActors.Num(), (TestViewableArea + TestMargin) * TestTiers);
+		});
+	});
+
+	Describe("Attached actors", [this] {
+		BeforeEach([this] {
+			TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+			Collection = CreateTestCollection();
+		});
+
+		AfterEach([this] {
+			TArray<AActor*> Items;
+			Collection->GetOwner()->GetAttachedActors(Items);
+			for (AActor* Item : Items)
+			{
+				Item->Destroy();
+			}
+
+			Collection->GetOwner()->Destroy();
+			Collection = nullptr;
+		});
+
+		It("should place added actors after the existing ones", [this] {
+			UWorld* World = UxtTestUtils::GetTestWorld();
+			const int32 NumItems = (TestViewableArea + 1) * TestTiers;
+			for (int32 Index = 0; Index < NumItems; ++Index)
+			{
+				Collection->AddActorToCollection(World->SpawnActor<AScrollingCollectionTestItem>());
+			}
+
+			const int32 LastVisibleItem = TestViewableArea * TestTiers - 1;
+			for (int32 Index = 0; Index < NumItems; ++Index)
+			{
+				const AActor* Item = Collection->GetItemActor(Index);
+				TestNotNull("Item is in the collection", Item);
+				if (Item)
+				{
+					const FVector ExpectedLocation(
+						0, -Collection->CellWidth * (Index % TestTiers), -Collection->CellHeight * (Index / TestTiers));
+					TestEqual("Item is placed in its cell", Item->GetRootComponent()->GetRelativeLocation(), ExpectedLocation);
+					TestEqual("Only items in the viewable area are shown", Item->IsHidden(), Index > LastVisibleItem);
+				}
+			}
+		});
+
+		It("should sort by key once until actors are added", [this] {
+			UWorld* World = UxtTestUtils::GetTestWorld();
+			UScrollingCollectionTestDataSource* SortKeySource = NewObject<UScrollingCollectionTestDataSource>();
+			FUxtObjectCollectionFloatSortKeyDelegate GetSortKey;
+			GetSortKey.BindDynamic(SortKeySource, &UScrollingCollectionTestDataSource::GetSortKey);
+			Collection->SetFloatSortKeyCallback(GetSortKey);
+
+			const int32 NumItems = 6;
+			for (int32 Index = 0; Index < NumItems; ++Index)
+			{
+				AScrollingCollectionTestItem* Item = World->SpawnActor<AScrollingCollectionTestItem>();
+				Item->ItemIndex = Index;
+				Collection->AddActorToCollection(Item);
+			}
+
+			const AScrollingCollectionTestItem* First = Cast<AScrollingCollectionTestItem>(Collection->GetItemActor(0));
+			const AScrollingCollectionTestItem* Last = Cast<AScrollingCollectionTestItem>(Collection->GetItemActor(NumItems - 1));
+			TestTrue("Items are sorted by key", First && First->ItemIndex == NumItems - 1 && Last && Last->ItemIndex == 0);
+
+			// Adding an actor that is already in the collection doesn't change the set of actors
+			const int32 SortKeyCount = SortKeySource->SortKeyCount;
+			const int32 ReaddedIndex = NumItems - 1;
+			AActor* ReaddedItem = Collection->GetItemActor(ReaddedIndex);
+			Collection->AddActorToCollection(ReaddedItem);
+			TestEqual("Sort keys are not requested again", SortKeySource->SortKeyCount, SortKeyCount);
+
+			// The collection has not scrolled, so items are placed relative to the collection itself
+			const FVector ExpectedLocation(
+				0, -Collection->CellWidth * (ReaddedIndex % TestTiers), -Collection->CellHeight * (ReaddedIndex / TestTiers));
+			TestTrue("Re-added item keeps its index", Collection->GetItemActor(ReaddedIndex) == ReaddedItem);
+			TestEqual(
+				"Re-added item is placed in its cell", ReaddedItem->GetActorLocation(),
+				Collection->GetComponentTransform().TransformPosition(ExpectedLocation));
+		});
+	});
+
+	Describe("Scroll physics", [this] {
+		BeforeEach([this] {
+			TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+
+			DataSource = NewObject<UScrollingCollectionTestDataSource>();
+			DataSource->AddToRoot();
+			Collection = CreateBouncingCollection(DataSource);
+			ReferenceCollection = CreateBouncingCollection(DataSource);
+		});
+
+		AfterEach([this] {
+			Collection->GetOwner()->Destroy();
+			Collection = nullptr;
+			ReferenceCollection->GetOwner()->Destroy();
+			ReferenceCollection = nullptr;
+
+			DataSource->RemoveFromRoot();
+			DataSource = nullptr;
+		});
+
+		It("should move the same regardless of frame rate", [this] {
+			const float MaxOffset = (NumBouncingItems / TestTiers - TestViewableArea) * Collection->CellHeight;
+			TestTrue("Collection is beyond its end", Collection->GetScrollOffset() > MaxOffset);
+
+			for (int32 Frame = 0; Frame < 60; ++Frame)
+			{
+				// Two steps per frame against half a step per frame
+				TickCollection(Collection, 2.0f * TestScrollTimeStep);
+				for (int32 SubFrame = 0; SubFrame < 4; ++SubFrame)
+				{
+					TickCollection(ReferenceCollection, 0.5f * TestScrollTimeStep);
+				}
+				TestEqual("Offsets are the same at the same time", Collection->GetScrollOffset(), ReferenceCollection->GetScrollOffset());
+			}
+
+			TestEqual("Collection has bounced back to its end", Collection->GetScrollOffset(), MaxOffset);
+		});
+
+		It("should stop ticking once settled", [this] {
+			TestFalse("Bouncing collection is not settled", Collection->IsSettled());
+
+			for (int32 Frame = 0; Frame < 120 && !Collection->IsSettled(); ++Frame)
+			{
+				TickCollection(Collection, BenchmarkDeltaTime);
+			}
+			TestTrue("Collection has settled", Collection->IsSettled());
+			TestFalse("Settled collection doesn't tick", Collection->IsComponentTickEnabled());
+
+			Collection->PageBy(-1, true, FUxtScrollingObjectCollectionOnPaginationEnd());
+			TestFalse("Pagination wakes the collection", Collection->IsSettled());
+			TestTrue("Paginating collection ticks", Collection->IsComponentTickEnabled());
+		});
+	});
+}
+
+BEGIN_DEFINE_SPEC(
+	ScrollingObjectCollectionPerfSpec, "UXTools.ScrollingObjectCollection.Performance",
+	EAutomationTestFlags::PerfFilter | EAutomationTestFlags::ApplicationContextMask)
+
+UUxtScrollingObjectCollection* Collection;
+
+END_DEFINE_SPEC(ScrollingObjectCollectionPerfSpec)
+
+void ScrollingObjectCollectionPerfSpec::Define()
+{
+	BeforeEach([this] {
+		TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+		Collection = CreateTestCollection();
+	});
+
+	AfterEach([this] {
+		TArray<AActor*> Items;
+		Collection->GetOwner()->GetAttachedActors(Items);
+		for (AActor* Item : Items)
+		{
+			Item->Destroy();
+		}
+
+		Collection->GetOwner()->Destroy();
+		Collection = nullptr;
+	});
+
+	It("should scroll 10k items faster than updating all of them", [this] {
+		const int32 NumItems = 10000;
+		UWorld* World = UxtTestUtils::GetTestWorld();
+		AActor* Owner = Collection->GetOwner();
+
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			AActor* Item = World->SpawnActor<AScrollingCollectionTestItem>();
+			Item->AttachToActor(Owner, FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+		}
+
+		// Adding one actor collects all of the attached actors in a single initialization
+		TArray<AActor*> Items;
+		Owner->GetAttachedActors(Items);
+		Collection->AddActorToCollection(Items.Last());
+
+		TestNotNull("Last item is in the collection", Collection->GetItemActor(NumItems - 1));
+		TestFalse("First item is shown", Collection->GetItemActor(0)->IsHidden());
+		TestTrue("Last item is hidden", Collection->GetItemActor(NumItems - 1)->IsHidden());
+
+		// Baseline: the visibility pass over every item that the collection used to run on each tick, on its own
+		TArray<AActor*> CollectionItems;
+		Owner->GetAttachedActors(CollectionItems);
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumBenchmarkFrames; ++Frame)
+		{
+			const int32 FrameFirstVisible = (Frame + 1) * TestTiers;
+			SetAllItemsVisibility(CollectionItems, FrameFirstVisible, FrameFirstVisible + TestViewableArea * TestTiers);
+		}
+		const double BaselineTime = (FPlatformTime::Seconds() - StartTime) / NumBenchmarkFrames;
+		SetAllItemsVisibility(CollectionItems, 0, TestViewableArea * TestTiers);
+
+		// Whole scroll frames, only actors entering or leaving the viewable area are updated
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumBenchmarkFrames; ++Frame)
+		{
+			TickScrollFrame(Collection);
+		}
+		const double IncrementalTime = (FPlatformTime::Seconds() - StartTime) / NumBenchmarkFrames;
+
+		const int32 FirstVisible = NumBenchmarkFrames * TestTiers;
+		const int32 FirstNotVisible = FirstVisible + TestViewableArea * TestTiers;
+		TestTrue("Item scrolled out of view is hidden", Collection->GetItemActor(FirstVisible - 1)->IsHidden());
+		TestFalse("First visible item is shown", Collection->GetItemActor(FirstVisible)->IsHidden());
+		TestFalse("Last visible item is shown", Collection->GetItemActor(FirstNotVisible - 1)->IsHidden());
+		TestTrue("Item after the viewable area is hidden", Collection->GetItemActor(FirstNotVisible)->IsHidden());
+
+		AddInfo(FString::Printf(
+			TEXT("Scrolling %d items: %.3f us per scroll frame, %.3f us per frame for the visibility update of all items"), NumItems,
+			IncrementalTime * 1.0e6, BaselineTime * 1.0e6));
+		TestTrue("Scroll frame is faster than updating all items", IncrementalTime < BaselineTime);
+	});
+}
+
+#endif
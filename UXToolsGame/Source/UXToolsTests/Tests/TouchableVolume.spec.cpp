@@ -145,7 +145,7 @@ void TouchableVolumeSpec::Define()
 		});
 
 		LatentIt("should not trigger events when near interaction is disabled", [this](const FDoneDelegate& Done) {
-			Target->InteractionMode = static_cast<int32>(EUxtInteractionMode::Far);
+			Target->SetInteractionMode(static_cast<int32>(EUxtInteractionMode::Far));
 
 			FrameQueue.Enqueue([this] { Hand.Translate(FVector(100, 0, 0)); });
 
@@ -165,7 +165,7 @@ void TouchableVolumeSpec::Define()
 			Mesh->SetWorldLocation(TargetLocation + FVector(0, 0, 100));
 			Mesh->RegisterComponent();
 
-			Target->TouchablePrimitives.Add(Mesh);
+			Target->SetTouchablePrimitives({Mesh});
 
 			FrameQueue.Enqueue([this] { Hand.Translate(FVector(100, 0, 0)); });
 
@@ -254,8 +254,48 @@ void TouchableVolumeSpec::Define()
 			FrameQueue.Enqueue([Done] { Done.Execute(); });
 		});
 
+		LatentIt("should not be focused after far interaction is disabled while unfocused", [this](const FDoneDelegate& Done) {
+			FrameQueue.Enqueue([this] {
+				TestEqual("Starts with focus", EventCaptureComponent->BeginFocusCount, 1);
+
+				Hand.Translate(FVector(0, 100, 0));
+			});
+
+			// The far target of the primitive is cached at this point, changing the mode must invalidate it
+			FrameQueue.Enqueue([this] {
+				Target->SetInteractionMode(static_cast<int32>(EUxtInteractionMode::Near));
+				Hand.Translate(FVector(0, -100, 0));
+			});
+
+			FrameQueue.Enqueue([this] { TestEqual("Begin focus not triggered", EventCaptureComponent->BeginFocusCount, 1); });
+
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+
+		LatentIt("should not be focused after its primitive is deselected while unfocused", [this](const FDoneDelegate& Done) {
+			// Added up front, so that only the setter can invalidate the cached far target
+			UStaticMeshComponent* Mesh = UxtTestUtils::CreateStaticMesh(Target->GetOwner());
+			Mesh->SetWorldLocation(TargetLocation + FVector(0, 0, 100));
+			Mesh->RegisterComponent();
+
+			FrameQueue.Enqueue([this] {
+				TestEqual("Starts with focus", EventCaptureComponent->BeginFocusCount, 1);
+
+				Hand.Translate(FVector(0, 100, 0));
+			});
+
+			FrameQueue.Enqueue([this, Mesh] {
+				Target->SetTouchablePrimitives({Mesh});
+				Hand.Translate(FVector(0, -100, 0));
+			});
+
+			FrameQueue.Enqueue([this] { TestEqual("Begin focus not triggered", EventCaptureComponent->BeginFocusCount, 1); });
+
+			FrameQueue.Enqueue([Done] { Done.Execute(); });
+		});
+
 		LatentIt("should not trigger events when far interaction is disabled", [this](const FDoneDelegate& Done) {
-			Target->InteractionMode = static_cast<int32>(EUxtInteractionMode::Near);
+			Target->SetInteractionMode(static_cast<int32>(EUxtInteractionMode::Near));
 
 			FrameQueue.Enqueue([this] { Hand.SetGrabbing(true); });
 
@@ -275,7 +315,7 @@ void TouchableVolumeSpec::Define()
 			Mesh->SetWorldLocation(TargetLocation + FVector(0, 0, 100));
 			Mesh->RegisterComponent();
 
-			Target->TouchablePrimitives.Add(Mesh);
+			Target->SetTouchablePrimitives({Mesh});
 
 			FrameQueue.Enqueue([this] { Hand.SetGrabbing(true); });
 
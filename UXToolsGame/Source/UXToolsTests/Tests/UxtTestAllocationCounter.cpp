@@ -0,0 +1,201 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "UxtTestAllocationCounter.h"
+
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTLS.h"
+
+namespace
+{
+	/** True while an allocation counter is in scope, counters replace GMalloc and cannot be nested. */
+	TAtomic<bool> bIsCounting{false};
+} // namespace
+
+/**
+ * Forwards all calls to the wrapped allocator and counts allocations made by a single thread.
+ * Calls that are still running are tracked, so that the allocator can be deleted once all of them have returned.
+ */
+class FCountingMalloc : public FMalloc
+{
+public:
+	FCountingMalloc(FMalloc* InInnerMalloc) : InnerMalloc(InInnerMalloc), CountingThreadId(FPlatformTLS::GetCurrentThreadId()) {}
+
+	int32 GetNumAllocations() const { return NumAllocations.Load(); }
+
+	/**
+	 * Wait until no other thread is inside the allocator, after it has been removed from GMalloc.
+	 * Yields at least once, so that a thread which read GMalloc just before it was restored has entered the allocator.
+	 */
+	void WaitForPendingCalls() const
+	{
+		do
+		{
+			FPlatformProcess::Yield();
+		} while (NumPendingCalls.Load() > 0);
+	}
+
+	virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		CountAllocation();
+		return InnerMalloc->Malloc(Size, Alignment);
+	}
+
+	virtual void* TryMalloc(SIZE_T Size, uint32 Alignment) override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		CountAllocation();
+		return InnerMalloc->TryMalloc(Size, Alignment);
+	}
+
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		if (NewSize > 0)
+		{
+			CountAllocation();
+		}
+		return InnerMalloc->Realloc(Ptr, NewSize, Alignment);
+	}
+
+	virtual void* TryRealloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		if (NewSize > 0)
+		{
+			CountAllocation();
+		}
+		return InnerMalloc->TryRealloc(Ptr, NewSize, Alignment);
+	}
+
+	virtual void Free(void* Ptr) override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		InnerMalloc->Free(Ptr);
+	}
+
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		return InnerMalloc->QuantizeSize(Count, Alignment);
+	}
+
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		return InnerMalloc->GetAllocationSize(Original, SizeOut);
+	}
+
+	virtual void Trim(bool bTrimThreadCaches) override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		InnerMalloc->Trim(bTrimThreadCaches);
+	}
+
+	virtual void SetupTLSCachesOnCurrentThread() override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		InnerMalloc->SetupTLSCachesOnCurrentThread();
+	}
+
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+	}
+
+	virtual void InitializeStatsMetadata() override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		InnerMalloc->InitializeStatsMetadata();
+	}
+
+	virtual void UpdateStats() override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		InnerMalloc->UpdateStats();
+	}
+
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		InnerMalloc->GetAllocatorStats(OutStats);
+	}
+
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		InnerMalloc->DumpAllocatorStats(Ar);
+	}
+
+	virtual bool IsInternallyThreadSafe() const override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		return InnerMalloc->IsInternallyThreadSafe();
+	}
+
+	virtual bool ValidateHeap() override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		return InnerMalloc->ValidateHeap();
+	}
+
+	virtual const TCHAR* GetDescriptiveName() override
+	{
+		FPendingCall PendingCall(NumPendingCalls);
+		return InnerMalloc->GetDescriptiveName();
+	}
+
+private:
+	/** Marks a call as running for its scope. */
+	struct FPendingCall
+	{
+		FPendingCall(TAtomic<int32>& InNumPendingCalls) : NumPendingCalls(InNumPendingCalls) { ++NumPendingCalls; }
+		~FPendingCall() { --NumPendingCalls; }
+
+		TAtomic<int32>& NumPendingCalls;
+	};
+
+	void CountAllocation()
+	{
+		if (FPlatformTLS::GetCurrentThreadId() == CountingThreadId)
+		{
+			++NumAllocations;
+		}
+	}
+
+	FMalloc* InnerMalloc;
+	uint32 CountingThreadId;
+	TAtomic<int32> NumAllocations{0};
+	mutable TAtomic<int32> NumPendingCalls{0};
+};
+
+FUxtScopedAllocationCounter::FUxtScopedAllocationCounter()
+{
+	checkf(!bIsCounting.Exchange(true), TEXT("Allocation counters cannot be nested"));
+
+	PreviousMalloc = GMalloc;
+	CountingMalloc = new FCountingMalloc(PreviousMalloc);
+	GMalloc = CountingMalloc;
+}
+
+FUxtScopedAllocationCounter::~FUxtScopedAllocationCounter()
+{
+	check(GMalloc == CountingMalloc);
+	GMalloc = PreviousMalloc;
+	FPlatformMisc::MemoryBarrier();
+
+	// Other threads may still be inside the counting allocator
+	CountingMalloc->WaitForPendingCalls();
+	delete CountingMalloc;
+	CountingMalloc = nullptr;
+
+	bIsCounting = false;
+}
+
+int32 FUxtScopedAllocationCounter::GetNumAllocations() const
+{
+	return CountingMalloc->GetNumAllocations();
+}
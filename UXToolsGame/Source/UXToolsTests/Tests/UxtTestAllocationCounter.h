@@ -0,0 +1,30 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Counts heap allocations made by the current thread while in scope.
+ *
+ * Temporarily wraps GMalloc in a forwarding allocator, allocations from other threads are passed through without being counted.
+ * GMalloc is restored and the wrapper deleted when the counter goes out of scope. Counters cannot be nested.
+ * Used by benchmarks that check code paths stay allocation free in steady state.
+ */
+class FUxtScopedAllocationCounter
+{
+public:
+	FUxtScopedAllocationCounter();
+	~FUxtScopedAllocationCounter();
+
+	FUxtScopedAllocationCounter(const FUxtScopedAllocationCounter&) = delete;
+	FUxtScopedAllocationCounter& operator=(const FUxtScopedAllocationCounter&) = delete;
+
+	/** Number of Malloc and Realloc calls made by the counting thread so far. */
+	int32 GetNumAllocations() const;
+
+private:
+	class FCountingMalloc* CountingMalloc;
+	FMalloc* PreviousMalloc;
+};
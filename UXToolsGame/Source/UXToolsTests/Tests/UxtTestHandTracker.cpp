@@ -57,6 +57,17 @@ bool FUxtTestHandTracker::GetPointerPose(EControllerHand Hand, FQuat& OutOrienta
 	return false;
 }
 
+bool FUxtTestHandTracker::GetPredictedPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const
+{
+	if (GetPointerPose(Hand, OutOrientation, OutPosition))
+	{
+		OutPosition += PredictedPointerOffset;
+		return true;
+	}
+
+	return false;
+}
+
 bool FUxtTestHandTracker::GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const
 {
 	const FUxtTestHandData& HandState = GetHandState(Hand);
@@ -108,6 +119,8 @@ const FUxtTestHandData& FUxtTestHandTracker::GetHandState(EControllerHand Hand)
 
 void FUxtTestHandTracker::SetTracked(bool bIsTracked, EControllerHand Hand)
 {
+	InvalidateHandSnapshots();
+
 	switch (Hand)
 	{
 	case EControllerHand::Left:
@@ -125,6 +138,8 @@ void FUxtTestHandTracker::SetTracked(bool bIsTracked, EControllerHand Hand)
 
 void FUxtTestHandTracker::SetGrabbing(bool bIsGrabbing, EControllerHand Hand)
 {
+	InvalidateHandSnapshots();
+
 	switch (Hand)
 	{
 	case EControllerHand::Left:
@@ -142,6 +157,8 @@ void FUxtTestHandTracker::SetGrabbing(bool bIsGrabbing, EControllerHand Hand)
 
 void FUxtTestHandTracker::SetSelectPressed(bool bIsSelectPressed, EControllerHand Hand)
 {
+	InvalidateHandSnapshots();
+
 	switch (Hand)
 	{
 	case EControllerHand::Left:
@@ -159,6 +176,8 @@ void FUxtTestHandTracker::SetSelectPressed(bool bIsSelectPressed, EControllerHan
 
 void FUxtTestHandTracker::SetJointPosition(const FVector& Position, EControllerHand Hand, EHandKeypoint Joint)
 {
+	InvalidateHandSnapshots();
+
 	switch (Hand)
 	{
 	case EControllerHand::Left:
@@ -176,6 +195,8 @@ void FUxtTestHandTracker::SetJointPosition(const FVector& Position, EControllerH
 
 void FUxtTestHandTracker::SetAllJointPositions(const FVector& Position, EControllerHand Hand)
 {
+	InvalidateHandSnapshots();
+
 	const int32 NumKeypoints = EHandKeypointCount;
 	switch (Hand)
 	{
@@ -203,6 +224,8 @@ void FUxtTestHandTracker::SetAllJointPositions(const FVector& Position, EControl
 
 void FUxtTestHandTracker::SetJointOrientation(const FQuat& Orientation, EControllerHand Hand, EHandKeypoint Joint)
 {
+	InvalidateHandSnapshots();
+
 	switch (Hand)
 	{
 	case EControllerHand::Left:
@@ -220,6 +243,8 @@ void FUxtTestHandTracker::SetJointOrientation(const FQuat& Orientation, EControl
 
 void FUxtTestHandTracker::SetAllJointOrientations(const FQuat& Orientation, EControllerHand Hand)
 {
+	InvalidateHandSnapshots();
+
 	const int32 NumKeypoints = EHandKeypointCount;
 	switch (Hand)
 	{
@@ -247,6 +272,8 @@ void FUxtTestHandTracker::SetAllJointOrientations(const FQuat& Orientation, ECon
 
 void FUxtTestHandTracker::SetJointRadius(float Radius, EControllerHand Hand, EHandKeypoint Joint)
 {
+	InvalidateHandSnapshots();
+
 	switch (Hand)
 	{
 	case EControllerHand::Left:
@@ -264,6 +291,8 @@ void FUxtTestHandTracker::SetJointRadius(float Radius, EControllerHand Hand, EHa
 
 void FUxtTestHandTracker::SetAllJointRadii(float Radius, EControllerHand Hand)
 {
+	InvalidateHandSnapshots();
+
 	const int32 NumKeypoints = EHandKeypointCount;
 	switch (Hand)
 	{
@@ -288,3 +317,8 @@ void FUxtTestHandTracker::SetAllJointRadii(float Radius, EControllerHand Hand)
 		break;
 	}
 }
+
+void FUxtTestHandTracker::SetPredictedPointerOffset(const FVector& Offset)
+{
+	PredictedPointerOffset = Offset;
+}
@@ -42,6 +42,7 @@ public:
 	virtual bool GetJointState(
 		EControllerHand Hand, EHandKeypoint Joint, FQuat& OutOrientation, FVector& OutPosition, float& OutRadius) const override;
 	virtual bool GetPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
+	virtual bool GetPredictedPointerPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
 	virtual bool GetGripPose(EControllerHand Hand, FQuat& OutOrientation, FVector& OutPosition) const override;
 	virtual bool GetIsGrabbing(EControllerHand Hand, bool& OutIsGrabbing) const override;
 	virtual bool GetIsSelectPressed(EControllerHand Hand, bool& OutIsSelectPressed) const override;
@@ -76,7 +77,13 @@ public:
 	/** Set radius for all joints of the hand. */
 	void SetAllJointRadii(float Radius, EControllerHand Hand = EControllerHand::AnyHand);
 
+	/** Set the offset added to the pointer position when predicting pointer poses. */
+	void SetPredictedPointerOffset(const FVector& Offset);
+
 private:
+	/** Offset of the predicted pointer position from the current one, zero disables prediction. */
+	FVector PredictedPointerOffset = FVector::ZeroVector;
+
 	/** Data for the left hand. */
 	FUxtTestHandData LeftHandData;
 
@@ -7,6 +7,7 @@
 #include "UxtTestUtils.h"
 
 #include "Components/PrimitiveComponent.h"
+#include "Input/UxtInputSubsystem.h"
 #include "Input/UxtNearPointerComponent.h"
 
 namespace
@@ -42,6 +43,18 @@ void UTestGrabTarget::BeginPlay()
 	EndFocusCount = 0;
 }
 
+void UTestGrabTarget::OnRegister()
+{
+	Super::OnRegister();
+	UUxtInputSubsystem::RegisterInterfaceComponent(this);
+}
+
+void UTestGrabTarget::OnUnregister()
+{
+	UUxtInputSubsystem::UnregisterInterfaceComponent(this);
+	Super::OnUnregister();
+}
+
 bool UTestGrabTarget::CanHandleGrab_Implementation(UPrimitiveComponent* Primitive) const
 {
 	return true;
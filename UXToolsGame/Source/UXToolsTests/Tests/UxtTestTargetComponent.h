@@ -31,6 +31,8 @@ class UXTOOLSTESTS_API UTestGrabTarget
 
 public:
 	virtual void BeginPlay() override;
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 
 	//
 	// IUxtGrabTarget interface
@@ -57,6 +59,7 @@ public:
 
 /**
  * Target for poke tests that counts poke events.
+ * Unlike the grab target it does not notify the input subsystem when it is registered.
  */
 UCLASS(ClassGroup = "UXToolsTests")
 class UXTOOLSTESTS_API UTestPokeTarget
@@ -0,0 +1,196 @@
+// Copyright (c) 2020 Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "Engine.h"
+#include "UxtTestAllocationCounter.h"
+#include "UxtTestUtils.h"
+#include "XRSimulationActor.h"
+#include "XRSimulationState.h"
+
+#include "HandTracking/UxtHandSnapshotBuffer.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	const int32 NumBenchmarkFrames = 1000;
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+	XRSimulationHandDataSpec, "UXTools.XRSimulation.HandData",
+	EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+
+AXRSimulationActor* SimulationActor;
+TSharedPtr<FXRSimulationState> SimulationState;
+
+END_DEFINE_SPEC(XRSimulationHandDataSpec)
+
+void XRSimulationHandDataSpec::Define()
+{
+	BeforeEach([this] {
+		TestTrueExpr(AutomationOpenMap(TEXT("/Game/UXToolsGame/Tests/Maps/TestEmpty")));
+
+		UWorld* World = UxtTestUtils::GetTestWorld();
+
+		SimulationState = MakeShared<FXRSimulationState>();
+		SimulationState->SetHandVisibility(EControllerHand::Left, true);
+		SimulationState->SetHandVisibility(EControllerHand::Right, true);
+
+		SimulationActor = World->SpawnActorDeferred<AXRSimulationActor>(AXRSimulationActor::StaticClass(), FTransform::Identity);
+		SimulationActor->SetSimulationState(SimulationState);
+		SimulationActor->FinishSpawning(FTransform::Identity);
+	});
+
+	AfterEach([this] {
+		SimulationActor->Destroy();
+		SimulationActor = nullptr;
+		SimulationState.Reset();
+	});
+
+	It("should not allocate while tracked", [this] {
+		FXRMotionControllerData LeftData;
+		FXRMotionControllerData RightData;
+
+		// First update sizes the keypoint arrays
+		SimulationActor->GetHandData(EControllerHand::Left, LeftData);
+		SimulationActor->GetHandData(EControllerHand::Right, RightData);
+		TestTrue("Left hand valid", LeftData.bValid);
+		TestEqual("Left hand keypoints", LeftData.HandKeyPositions.Num(), EHandKeypointCount);
+
+		int32 NumAllocations;
+		double Elapsed;
+		{
+			FUxtScopedAllocationCounter AllocationCounter;
+			const double StartTime = FPlatformTime::Seconds();
+
+			for (int32 Frame = 0; Frame < NumBenchmarkFrames; ++Frame)
+			{
+				SimulationActor->GetHandData(EControllerHand::Left, LeftData);
+				SimulationActor->GetHandData(EControllerHand::Right, RightData);
+			}
+
+			Elapsed = FPlatformTime::Seconds() - StartTime;
+			NumAllocations = AllocationCounter.GetNumAllocations();
+		}
+
+		AddInfo(FString::Printf(
+			TEXT("GetHandData: %.3f us per frame for both hands, %d allocations over %d frames"), Elapsed * 1.0e6 / NumBenchmarkFrames,
+			NumAllocations, NumBenchmarkFrames));
+		TestEqual("Allocations in steady state", NumAllocations, 0);
+	});
+
+	It("should not allocate while updating hand snapshots", [this] {
+		// Same per-frame path as the default hand tracker subsystem while simulating
+		FXRMotionControllerData LeftData;
+		FXRMotionControllerData RightData;
+		FUxtHandSnapshot LeftSnapshot;
+		FUxtHandSnapshot RightSnapshot;
+		FUxtHandSnapshotBuffer PublishedSnapshots;
+
+		SimulationActor->GetHandData(EControllerHand::Left, LeftData);
+		SimulationActor->GetHandData(EControllerHand::Right, RightData);
+
+		int32 NumAllocations;
+		double Elapsed;
+		{
+			FUxtScopedAllocationCounter AllocationCounter;
+			const double StartTime = FPlatformTime::Seconds();
+
+			for (int32 Frame = 0; Frame < NumBenchmarkFrames; ++Frame)
+			{
+				SimulationActor->GetHandData(EControllerHand::Left, LeftData);
+				SimulationActor->GetHandData(EControllerHand::Right, RightData);
+				LeftSnapshot.CopyFromMotionControllerData(LeftData);
+				RightSnapshot.CopyFromMotionControllerData(RightData);
+				PublishedSnapshots.Publish(LeftSnapshot, RightSnapshot);
+			}
+
+			Elapsed = FPlatformTime::Seconds() - StartTime;
+			NumAllocations = AllocationCounter.GetNumAllocations();
+		}
+
+		AddInfo(FString::Printf(
+			TEXT("Hand snapshot update: %.3f us per frame for both hands, %d allocations over %d frames"),
+			Elapsed * 1.0e6 / NumBenchmarkFrames, NumAllocations, NumBenchmarkFrames));
+		TestEqual("Allocations in steady state", NumAllocations, 0);
+		TestTrue("Left snapshot has joints", LeftSnapshot.bHasJoints);
+		const int32 Wrist = static_cast<int32>(EHandKeypoint::Wrist);
+		TestEqual("Left snapshot wrist", LeftSnapshot.JointPositions[Wrist], LeftData.HandKeyPositions[Wrist]);
+	});
+
+	It("should reuse keypoint storage when tracking toggles", [this] {
+		FXRMotionControllerData Data;
+		SimulationActor->GetHandData(EControllerHand::Right, Data);
+		const FVector* PositionsData = Data.HandKeyPositions.GetData();
+		const FQuat* RotationsData = Data.HandKeyRotations.GetData();
+		const float* RadiiData = Data.HandKeyRadii.GetData();
+
+		SimulationState->SetHandVisibility(EControllerHand::Right, false);
+		SimulationActor->GetHandData(EControllerHand::Right, Data);
+		TestFalse("Hand valid", Data.bValid);
+		TestEqual("Keypoints while untracked", Data.HandKeyPositions.Num(), 0);
+
+		SimulationState->SetHandVisibility(EControllerHand::Right, true);
+		SimulationActor->GetHandData(EControllerHand::Right, Data);
+		TestTrue("Hand valid", Data.bValid);
+		TestEqual("Keypoints while tracked", Data.HandKeyPositions.Num(), EHandKeypointCount);
+		TestTrue("Positions reused", Data.HandKeyPositions.GetData() == PositionsData);
+		TestTrue("Rotations reused", Data.HandKeyRotations.GetData() == RotationsData);
+		TestTrue("Radii reused", Data.HandKeyRadii.GetData() == RadiiData);
+	});
+
+	It("should use cached keypoint bone indices after the first tick", [this] {
+		TestFalse("Bone indices cached before tick", SimulationActor->HasKeypointBoneIndices(EControllerHand::Right));
+
+		// Keypoints are looked up by bone name until the actor has ticked
+		FXRMotionControllerData LookupData;
+		SimulationActor->GetHandData(EControllerHand::Right, LookupData);
+
+		SimulationActor->Tick(0.0f);
+		TestTrue("Bone indices cached after tick", SimulationActor->HasKeypointBoneIndices(EControllerHand::Right));
+
+		FXRMotionControllerData CachedData;
+		SimulationActor->GetHandData(EControllerHand::Right, CachedData);
+		TestEqual("Keypoints", CachedData.HandKeyPositions.Num(), LookupData.HandKeyPositions.Num());
+		for (int32 Keypoint = 0; Keypoint < CachedData.HandKeyPositions.Num(); ++Keypoint)
+		{
+			TestEqual("Keypoint position", CachedData.HandKeyPositions[Keypoint], LookupData.HandKeyPositions[Keypoint]);
+			TestTrue("Keypoint rotation", CachedData.HandKeyRotations[Keypoint].Equals(LookupData.HandKeyRotations[Keypoint]));
+		}
+	});
+
+	It("should invalidate cached keypoint bone indices when the hand mesh changes", [this] {
+		USkeletalMeshComponent* HandMesh = SimulationActor->GetRightHand();
+		USkeletalMesh* SkeletalMesh = HandMesh->SkeletalMesh;
+		TestNotNull("Hand has a mesh", SkeletalMesh);
+
+		SimulationActor->Tick(0.0f);
+
+		// Bone transforms are released along with the mesh, cached indices must not be used until rebuilt
+		HandMesh->SetSkeletalMesh(nullptr);
+		TestFalse("Bone indices cached without mesh", SimulationActor->HasKeypointBoneIndices(EControllerHand::Right));
+		SimulationActor->Tick(0.0f);
+		TestFalse("Bone indices cached without mesh after tick", SimulationActor->HasKeypointBoneIndices(EControllerHand::Right));
+
+		HandMesh->SetSkeletalMesh(SkeletalMesh);
+		TestFalse("Bone indices cached before tick", SimulationActor->HasKeypointBoneIndices(EControllerHand::Right));
+		FXRMotionControllerData LookupData;
+		SimulationActor->GetHandData(EControllerHand::Right, LookupData);
+
+		SimulationActor->Tick(0.0f);
+		TestTrue("Bone indices rebuilt after tick", SimulationActor->HasKeypointBoneIndices(EControllerHand::Right));
+		TestTrue("Left hand indices unaffected", SimulationActor->HasKeypointBoneIndices(EControllerHand::Left));
+
+		FXRMotionControllerData CachedData;
+		SimulationActor->GetHandData(EControllerHand::Right, CachedData);
+		TestTrue("Hand valid", CachedData.bValid);
+		TestEqual("Keypoints", CachedData.HandKeyPositions.Num(), EHandKeypointCount);
+		for (int32 Keypoint = 0; Keypoint < CachedData.HandKeyPositions.Num(); ++Keypoint)
+		{
+			TestEqual("Keypoint position", CachedData.HandKeyPositions[Keypoint], LookupData.HandKeyPositions[Keypoint]);
+		}
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -15,7 +15,7 @@ public class UXToolsTests : ModuleRules
 		// Never enable unity builds for tests
 		MinSourceFilesForUnityBuildOverride = System.Int32.MaxValue;
 
-		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "HeadMountedDisplay", "LiveLinkInterface", "UXTools" });
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "HeadMountedDisplay", "LiveLinkInterface", "UXTools", "XRSimulation" });
 
 		PrivateDependencyModuleNames.AddRange(new string[] { "Projects", "RenderCore", "Slate", "SlateCore", "UMG", "FunctionalTesting" });
 		if (Target.bBuildEditor)